@@ -0,0 +1,115 @@
+/**
+ * @file arena.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "arena.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <new>
+
+Arena::Arena(std::size_t block_size)
+: block_size(std::max<std::size_t>(block_size, block_alignment)),
+  offset(0),
+  bytes_used(0),
+  bytes_reserved(0)
+{
+}
+
+Arena::~Arena()
+{
+	release();
+}
+
+void* Arena::allocate(std::size_t size, std::size_t alignment)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// Allocate even empty arrays, such that every allocation is unique
+	size = std::max<std::size_t>(size, 1);
+	alignment = std::min(alignment, block_alignment);
+
+	std::size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+	if (!blocks.empty() && aligned + size <= blocks.back().size) {
+		offset = aligned + size;
+		bytes_used += size;
+		return blocks.back().data + aligned;
+	}
+
+	// Large allocations that do not fit get a dedicated block and the
+	// current block remains in use
+	if (size > block_size / 4) {
+		unsigned char* data = static_cast<unsigned char*>(::operator new(size, std::align_val_t(block_alignment)));
+		large_blocks.push_back({ data, size });
+		bytes_used += size;
+		bytes_reserved += size;
+		return data;
+	}
+
+	addBlock(block_size);
+	offset = size;
+	bytes_used += size;
+	return blocks.back().data;
+}
+
+void Arena::reserve(std::size_t size)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (!blocks.empty() && offset + size <= blocks.back().size) {
+		return;
+	}
+	addBlock(std::max(size, block_size));
+}
+
+void Arena::addBlock(std::size_t size)
+{
+	unsigned char* data = static_cast<unsigned char*>(::operator new(size, std::align_val_t(block_alignment)));
+	blocks.push_back({ data, size });
+	bytes_reserved += size;
+	offset = 0;
+}
+
+void Arena::addDestructor(void* object, void (*destroy)(void* object))
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	destructors.push_back({ object, destroy });
+}
+
+void Arena::release()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	for (auto iter = destructors.rbegin(); iter != destructors.rend(); ++iter) {
+		iter->destroy(iter->object);
+	}
+	destructors.clear();
+
+	for (auto* list : { &blocks, &large_blocks }) {
+		for (auto&& block : *list) {
+			::operator delete(block.data, std::align_val_t(block_alignment));
+		}
+		list->clear();
+	}
+
+	offset = 0;
+	bytes_used = 0;
+	bytes_reserved = 0;
+}
+
+std::size_t Arena::bytesUsed() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return bytes_used;
+}
+
+std::size_t Arena::bytesReserved() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return bytes_reserved;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file arena.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_ARENA_H
+#define CORTEX_ARENA_H
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Region allocator that places small objects and arrays
+ *        contiguously in large blocks and releases them all at once.
+ *
+ * Allocations are bump allocations from the current block. Allocations
+ * larger than a quarter of the block size that do not fit the remainder of
+ * the current block get a dedicated block, such that they do not waste the
+ * remainder of the current block. Callers that know the total size of their
+ * large arrays up front, such as scene loaders, use @ref reserve() to place
+ * them in a single shared block instead.
+ * Objects created with @ref create() are destroyed in reverse order of
+ * creation when the arena is released; arrays are not destroyed and must
+ * be of trivially destructible types. Containers can allocate from the
+ * arena using @ref ArenaAllocator.
+ *
+ * Allocation is thread-safe, which allows the meshes of an entity to be
+ * converted concurrently.
+ */
+class Arena
+{
+public:
+	/// Default block size in bytes
+	static constexpr std::size_t default_block_size = 1 << 20;
+
+	/// Alignment of every block, which suits SIMD and cache line access
+	static constexpr std::size_t block_alignment = 64;
+
+	explicit Arena(std::size_t block_size = default_block_size);
+	~Arena();
+
+	Arena(const Arena&) = delete;
+	Arena& operator=(const Arena&) = delete;
+
+	/**
+	 * Allocate uninitialized memory.
+	 * @param size Size in bytes
+	 * @param alignment Alignment in bytes; a power of two of at most
+	 *                  @ref block_alignment
+	 */
+	void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+	/// Allocate uninitialized array of @p count trivially destructible elements
+	template<typename T>
+	T* allocateArray(std::size_t count);
+
+	/// Construct object that is destroyed when the arena is released
+	template<typename T, typename... Args>
+	T* create(Args&&... args);
+
+	/**
+	 * Make sure that the next @p size bytes of allocations, including
+	 * large ones, are placed in the current block. If the remainder of the
+	 * current block is smaller, a new block of at least @p size bytes
+	 * becomes the current block.
+	 * @param size Size in bytes, including alignment padding
+	 */
+	void reserve(std::size_t size);
+
+	/// Destroy all objects and free all blocks
+	void release();
+
+	/// Number of bytes allocated, excluding alignment padding
+	std::size_t bytesUsed() const;
+
+	/// Number of bytes in blocks
+	std::size_t bytesReserved() const;
+
+private:
+	struct Block {
+		unsigned char* data;
+		std::size_t size;
+	};
+
+	struct Destructor {
+		void* object;
+		void (*destroy)(void* object);
+	};
+
+	void addDestructor(void* object, void (*destroy)(void* object));
+	void addBlock(std::size_t size); ///< Caller must hold @ref mutex
+
+	const std::size_t block_size;
+	mutable std::mutex mutex;
+	std::vector<Block> blocks; ///< Shared blocks; the last one is current
+	std::vector<Block> large_blocks; ///< Dedicated blocks
+	std::vector<Destructor> destructors;
+	std::size_t offset; ///< Offset of the next allocation in the last block
+	std::size_t bytes_used;
+	std::size_t bytes_reserved;
+};
+
+/**
+ * @brief Allocator that allocates from an @ref Arena, or from the heap if
+ *        no arena is given.
+ *
+ * Memory allocated from an arena is only freed when the arena is released,
+ * such that containers using this allocator should be sized once, for
+ * example using @c reserve() or @c assign(), instead of grown repeatedly.
+ */
+template<typename T>
+class ArenaAllocator
+{
+public:
+	using value_type = T;
+
+	ArenaAllocator(Arena* arena = nullptr) noexcept : arena(arena) {}
+
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+	T* allocate(std::size_t count);
+	void deallocate(T* p, std::size_t count) noexcept;
+
+	template<typename U>
+	bool operator==(const ArenaAllocator<U>& other) const noexcept { return arena == other.arena; }
+
+	template<typename U>
+	bool operator!=(const ArenaAllocator<U>& other) const noexcept { return arena != other.arena; }
+
+private:
+	template<typename U>
+	friend class ArenaAllocator;
+
+	Arena* arena;
+};
+
+/// Vector that allocates from an @ref Arena, or from the heap
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+#include "arena.tcc"
+
+#endif
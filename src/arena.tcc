@@ -0,0 +1,56 @@
+/**
+ * @file arena.tcc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "arena.h"
+
+#ifndef CORTEX_ARENA_TCC
+#define CORTEX_ARENA_TCC
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename T>
+T* Arena::allocateArray(std::size_t count)
+{
+	static_assert(std::is_trivially_destructible<T>::value, "Arena arrays are not destroyed");
+
+	return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+}
+
+template<typename T, typename... Args>
+T* Arena::create(Args&&... args)
+{
+	T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+	if (!std::is_trivially_destructible<T>::value) {
+		addDestructor(object, [](void* p) { static_cast<T*>(p)->~T(); });
+	}
+	return object;
+}
+
+template<typename T>
+T* ArenaAllocator<T>::allocate(std::size_t count)
+{
+	if (arena) {
+		return arena->allocateArray<T>(count);
+	}
+	return std::allocator<T>().allocate(count);
+}
+
+template<typename T>
+void ArenaAllocator<T>::deallocate(T* p, std::size_t count) noexcept
+{
+	// Arena memory is freed when the arena is released
+	if (!arena) {
+		std::allocator<T>().deallocate(p, count);
+	}
+}
+
+#endif
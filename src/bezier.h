@@ -11,6 +11,7 @@
 #define CORTEX_BEZIER_H
 
 #include "vertex_traits.h"
+#include "topology.h"
 
 #include <cstddef>
 #include <vector>
@@ -81,19 +82,21 @@ struct BezierCurve
 	 * Appends @p t_count uniformly spaced vertices to @p vertices and appends
 	 * GL_LINES indices to @p indices.
 	 *
-	 * @tparam VertexType 2D vertex type with a @p .position member assignable
-	 *                    from T. Optional @p .normal member is assigned from T
-	 *                    when present. Optional @p .tangent member is assigned
-	 *                    from T when present. Optional @p .texcoord member is
-	 *                    assigned from sample point t when present.
+	 * @tparam VertexBuffer Vertex container, such as @c std::vector or
+	 *                      @ref SplitVertexBuffer, of 2D vertex type with a
+	 *                      @p .position member assignable from T. Optional
+	 *                      @p .normal member is assigned from T when present.
+	 *                      Optional @p .tangent member is assigned from T when
+	 *                      present. Optional @p .texcoord member is assigned
+	 *                      from sample point t when present.
 	 * @tparam IndexType Integer type suitable for array indices.
 	 *
 	 * @param t_count Number of sample points. Must be >= 2.
 	 * @param vertices Vertex buffer output. New vertices are appended.
 	 * @param indices Index buffer output. New indices are appended.
 	 */
-	template<typename VertexType, typename IndexType = unsigned int>
-	void tessellate(std::size_t t_count, std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const;
+	template<typename VertexBuffer, typename IndexType = unsigned int>
+	void tessellate(std::size_t t_count, VertexBuffer& vertices, std::vector<IndexType>& indices) const;
 };
 
 /**
@@ -178,13 +181,18 @@ struct BezierSurface
 	 * Appends @p u_count x @p v_count uniformly spaced vertices to @p vertices
 	 * and appends GL_TRIANGLES indices to @p indices.
 	 *
-	 * @tparam VertexType 3D vertex type with a @p .position member assignable
-	 *                    from T. Optional @p .normal member is assigned from T
-	 *                    when present. Optional @p .tangent member is assigned
-	 *                    from T when present. Optional @p .bitangent member is
-	 *                    assigned from T when present. Optional @p .texcoord
-	 *                    member is assigned from sample point (u, v) when
-	 *                    present.
+	 * @tparam VertexBuffer Vertex container, such as @c std::vector or
+	 *                      @ref SplitVertexBuffer, of 3D vertex type with a
+	 *                      @p .position member assignable from T. Optional
+	 *                      @p .normal member is assigned from T when present.
+	 *                      Optional @p .tangent member is assigned from T when
+	 *                      present, or from T and a handedness of +1 when it
+	 *                      has four components. Optional @p .bitangent member
+	 *                      is assigned from T when present. Optional
+	 *                      @p .texcoord member is assigned from sample point
+	 *                      (u, v) when present. Optional members may use the
+	 *                      packed types in packed.h, which encode on
+	 *                      assignment.
 	 * @tparam IndexType Integer type suitable for array indices.
 	 *
 	 * @param u_count Number of sample points along u. Must be >= 2.
@@ -192,8 +200,19 @@ struct BezierSurface
 	 * @param vertices Vertex buffer output. New vertices are appended.
 	 * @param indices Index buffer output. New indices are appended.
 	 */
-	template<typename VertexType, typename IndexType = unsigned int>
-	void tessellate(std::size_t u_count, std::size_t v_count, std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const;
+	template<typename VertexBuffer, typename IndexType = unsigned int>
+	void tessellate(std::size_t u_count, std::size_t v_count, VertexBuffer& vertices, std::vector<IndexType>& indices) const;
+
+	/**
+	 * @brief Grid topology of the indices produced by @ref tessellate.
+	 *
+	 * All surfaces tessellated with the same @p u_count and @p v_count share
+	 * the same topology and may therefore share index data.
+	 *
+	 * @param u_count Number of sample points along u. Must be >= 2.
+	 * @param v_count Number of sample points along v. Must be >= 2.
+	 */
+	GridTopology topology(std::size_t u_count, std::size_t v_count) const;
 };
 
 template <typename T, std::size_t n>
@@ -13,6 +13,7 @@
 #define CORTEX_BEZIER_TCC
 
 #include "vertex_traits.h"
+#include "topology.h"
 
 #include <cmath>
 #include <utility>
@@ -122,9 +123,10 @@ T BezierCurve<T,n>::normal(double t) const
 }
 
 template <typename T, std::size_t n>
-template <typename VertexType, typename IndexType>
-void BezierCurve<T,n>::tessellate(std::size_t t_count, std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const
+template <typename VertexBuffer, typename IndexType>
+void BezierCurve<T,n>::tessellate(std::size_t t_count, VertexBuffer& vertices, std::vector<IndexType>& indices) const
 {
+	using VertexType = typename VertexBuffer::value_type;
 	static_assert(std::is_default_constructible<VertexType>::value, "VertexType must be default-constructible");
 	static_assert(std::is_integral<IndexType>::value, "IndexType must be an integer type");
 
@@ -220,14 +222,14 @@ T BezierSurface<T,n,m>::normal(double u, double v) const
 }
 
 template <typename T, std::size_t n, std::size_t m>
-template <typename VertexType, typename IndexType>
-void BezierSurface<T,n,m>::tessellate(std::size_t u_count, std::size_t v_count, std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const
+template <typename VertexBuffer, typename IndexType>
+void BezierSurface<T,n,m>::tessellate(std::size_t u_count, std::size_t v_count, VertexBuffer& vertices, std::vector<IndexType>& indices) const
 {
+	using VertexType = typename VertexBuffer::value_type;
 	static_assert(std::is_default_constructible<VertexType>::value, "VertexType must be default-constructible");
 	static_assert(std::is_integral<IndexType>::value, "IndexType must be an integer type");
 
 	vertices.reserve(vertices.size() + (u_count * v_count));
-	indices.reserve(indices.size() + ((u_count - 1) * (v_count - 1) * 3 * 2));
 
 	std::size_t offset = vertices.size();
 	for (std::size_t i = 0; i < u_count; ++i) {
@@ -240,7 +242,12 @@ void BezierSurface<T,n,m>::tessellate(std::size_t u_count, std::size_t v_count,
 			if constexpr (detail::has_normal<VertexType>::value) {
 				vertex.normal = normal(u, v);
 			}
-			if constexpr (detail::has_tangent<VertexType>::value) {
+			if constexpr (detail::has_tangent_handedness<VertexType>::value) {
+				// Handedness is +1 because the normal is dp/du x dp/dv
+				using M = decltype(vertex.tangent);
+				T du = tangent(u, v);
+				vertex.tangent = M(du[0], du[1], du[2], 1.0f);
+			} else if constexpr (detail::has_tangent<VertexType>::value) {
 				vertex.tangent = tangent(u, v);
 			}
 			if constexpr (detail::has_bitangent<VertexType>::value) {
@@ -251,17 +258,16 @@ void BezierSurface<T,n,m>::tessellate(std::size_t u_count, std::size_t v_count,
 				vertex.texcoord = { static_cast<S>(u), static_cast<S>(v) };
 			}
 			vertices.push_back(std::move(vertex));
-
-			if (i < u_count - 1 && j < v_count - 1) {
-				indices.push_back(static_cast<IndexType>(offset + (i * v_count + j)));
-				indices.push_back(static_cast<IndexType>(offset + ((i + 1) * v_count + j)));
-				indices.push_back(static_cast<IndexType>(offset + (i * v_count + j + 1)));
-				indices.push_back(static_cast<IndexType>(offset + (i * v_count + j + 1)));
-				indices.push_back(static_cast<IndexType>(offset + ((i + 1) * v_count + j)));
-				indices.push_back(static_cast<IndexType>(offset + ((i + 1) * v_count + j + 1)));
-			}
 		}
 	}
+
+	topology(u_count, v_count).tessellate(indices, offset);
+}
+
+template <typename T, std::size_t n, std::size_t m>
+GridTopology BezierSurface<T,n,m>::topology(std::size_t u_count, std::size_t v_count) const
+{
+	return GridTopology{ u_count, v_count, false, false };
 }
 
 template <typename T, std::size_t n>
@@ -0,0 +1,52 @@
+/**
+ * @file bounds.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "bounds.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+Bounds::Bounds()
+: min{ FLT_MAX, FLT_MAX, FLT_MAX },
+  max{ -FLT_MAX, -FLT_MAX, -FLT_MAX },
+  center{ 0.0f, 0.0f, 0.0f },
+  radius(0.0f)
+{
+}
+
+void Bounds::extend(const Bounds& other)
+{
+	if (other.empty()) {
+		return;
+	}
+
+	for (unsigned int i = 0; i < 3; ++i) {
+		min[i] = std::min(min[i], other.min[i]);
+		max[i] = std::max(max[i], other.max[i]);
+	}
+	updateSphere();
+}
+
+void Bounds::updateSphere()
+{
+	if (empty()) {
+		center[0] = center[1] = center[2] = 0.0f;
+		radius = 0.0f;
+		return;
+	}
+
+	float length2 = 0.0f;
+	for (unsigned int i = 0; i < 3; ++i) {
+		float half_extent = (max[i] - min[i]) * 0.5f;
+		center[i] = min[i] + half_extent;
+		length2 += half_extent * half_extent;
+	}
+	radius = std::sqrt(length2);
+}
@@ -0,0 +1,40 @@
+/**
+ * @file bounds.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_BOUNDS_H
+#define CORTEX_BOUNDS_H
+
+/**
+ * @brief Axis-aligned bounding box with the bounding sphere that encloses
+ *        it, for culling and camera framing.
+ *
+ * The sphere is derived from the box such that both are available without
+ * scanning vertex data again. Empty bounds have a minimum greater than
+ * their maximum and a zero sphere.
+ */
+struct Bounds {
+	float min[3];
+	float max[3];
+	float center[3]; ///< Bounding sphere center, which is the box center
+	float radius; ///< Bounding sphere radius, which is half the box diagonal
+
+	/// Construct empty bounds
+	Bounds();
+
+	/// Boolean indicating whether the bounds contain no points
+	bool empty() const { return min[0] > max[0]; }
+
+	/// Extend box by @p other and update the sphere
+	void extend(const Bounds& other);
+
+	/// Update the sphere after changing the box
+	void updateSphere();
+};
+
+#endif
@@ -8,19 +8,50 @@
  */
 
 #include "entity.h"
-#include "material.h"
+#include "mappedfile.h"
+#include "materialtable.h"
 #include "mesh.h"
 
-Entity::Entity(const std::string& name)
-: name(name)
+#include <algorithm>
+#include <utility>
+
+Entity::Entity(const std::string& name, std::shared_ptr<MaterialTable> materials)
+: name(name),
+  materials(materials ? std::move(materials) : std::make_shared<MaterialTable>()),
+  storage(nullptr)
 {
 }
 
 Entity::~Entity()
 {
-	for (auto&& itr : materials)
-		delete itr;
+	// Release all meshes and their data at once
+	arena.release();
+	delete storage;
+}
+
+void Entity::updateBounds()
+{
+	bounds = Bounds();
+
+	for (const Instance& instance : instances) {
+		const Bounds& mesh_bounds = instance.mesh->bounds;
+		if (mesh_bounds.empty()) {
+			continue;
+		}
 
-	for (auto&& itr : meshes)
-		delete itr;
+		// Transform box by accumulating the extremes of each matrix term
+		// (Arvo, 1990) instead of transforming all eight corners
+		Bounds instance_bounds;
+		for (unsigned int row = 0; row < 3; ++row) {
+			// glm::mat4 is column-major
+			instance_bounds.min[row] = instance_bounds.max[row] = instance.transform[3][row];
+			for (unsigned int col = 0; col < 3; ++col) {
+				float a = instance.transform[col][row] * mesh_bounds.min[col];
+				float b = instance.transform[col][row] * mesh_bounds.max[col];
+				instance_bounds.min[row] += std::min(a, b);
+				instance_bounds.max[row] += std::max(a, b);
+			}
+		}
+		bounds.extend(instance_bounds);
+	}
 }
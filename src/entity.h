@@ -10,27 +10,82 @@
 #ifndef CORTEX_ENTITY
 #define CORTEX_ENTITY
 
+#include "arena.h"
+#include "bounds.h"
+#include "mesh.h"
+
+#include "glm/glm.hpp"
+
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
-#include <list>
 
 // Forward declarations
-class Material;
-class Mesh;
+class MappedFile;
+class MaterialTable;
 
 class Entity
 {
+public:
+	/**
+	 * @brief Placement of a mesh within the entity.
+	 *
+	 * Meshes referenced by several scene nodes are stored once in
+	 * @ref meshes, in mesh space, and have one instance per node, which
+	 * allows them to be drawn with instancing. Meshes referenced by a single
+	 * node are stored in entity space and have an identity transform.
+	 */
+	struct Instance {
+		Mesh* mesh; ///< Mesh owned by @ref meshes
+		glm::mat4 transform; ///< Mesh to entity space transform
+	};
+
 public:
 	std::string name;
-	std::vector<Material*> materials;
-	std::list<Mesh*> meshes;
+	std::shared_ptr<MaterialTable> materials; ///< Indexed by the meshes
+	std::vector<Mesh*> meshes; ///< Meshes created in @ref arena
+	std::vector<Instance> instances;
+	Bounds bounds; ///< Bounds of all instances in entity space. See @ref updateBounds().
+
+	/// Storage referenced by external mesh data, such as a scene cache file
+	MappedFile* storage;
+
+	/**
+	 * Storage of the meshes and all of their data, which is released at
+	 * once when the entity is destroyed. Create meshes using
+	 * @ref createMesh(). Mesh data is written in place once its final size
+	 * is known; see @ref Arena::reserve() for placing the data of all
+	 * meshes in a single block.
+	 */
+	Arena arena;
 
 public:
-	Entity(const std::string& name);
+	/**
+	 * Constructor
+	 * @param name Entity name
+	 * @param materials Material table shared with other entities, or
+	 *                  nullptr for a new table
+	 */
+	Entity(const std::string& name, std::shared_ptr<MaterialTable> materials = nullptr);
 	virtual ~Entity();
 
 	Entity(const Entity&) = delete;
 	Entity& operator=(const Entity&) = delete;
+
+	/**
+	 * Compute @ref bounds from the bounds of the instanced meshes, without
+	 * scanning vertex data.
+	 */
+	void updateBounds();
+
+	/**
+	 * Create mesh in @ref arena, which also holds the mesh data. The caller
+	 * adds it to @ref meshes.
+	 * @see Mesh::Mesh
+	 */
+	template<typename... Args>
+	Mesh* createMesh(Args&&... args) { return arena.create<Mesh>(&arena, std::forward<Args>(args)...); }
 };
 
 #endif
@@ -0,0 +1,216 @@
+/**
+ * @file importprofile.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "importprofile.h"
+
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+
+// Post-processing steps in the order of the pipeline of Assimp 6, which is
+// the version required by the build
+static const ImportProfile::Step pipeline_steps[] = {
+	{ "ValidateDataStructure", aiProcess_ValidateDataStructure },
+	{ "MakeLeftHanded", aiProcess_MakeLeftHanded },
+	{ "FlipUVs", aiProcess_FlipUVs },
+	{ "FlipWindingOrder", aiProcess_FlipWindingOrder },
+	{ "RemoveComponent", aiProcess_RemoveComponent },
+	{ "RemoveRedundantMaterials", aiProcess_RemoveRedundantMaterials },
+	{ "EmbedTextures", aiProcess_EmbedTextures },
+	{ "FindInstances", aiProcess_FindInstances },
+	{ "OptimizeGraph", aiProcess_OptimizeGraph },
+	{ "GenUVCoords", aiProcess_GenUVCoords },
+	{ "TransformUVCoords", aiProcess_TransformUVCoords },
+	{ "GlobalScale", aiProcess_GlobalScale },
+	{ "PopulateArmatureData", aiProcess_PopulateArmatureData },
+	{ "PreTransformVertices", aiProcess_PreTransformVertices },
+	{ "Triangulate", aiProcess_Triangulate },
+	{ "FindDegenerates", aiProcess_FindDegenerates },
+	{ "SortByPType", aiProcess_SortByPType },
+	{ "FindInvalidData", aiProcess_FindInvalidData },
+	{ "OptimizeMeshes", aiProcess_OptimizeMeshes },
+	{ "FixInfacingNormals", aiProcess_FixInfacingNormals },
+	{ "SplitByBoneCount", aiProcess_SplitByBoneCount },
+	{ "DropNormals", aiProcess_DropNormals },
+	{ "GenNormals", aiProcess_GenNormals },
+	{ "GenSmoothNormals", aiProcess_GenSmoothNormals },
+	{ "CalcTangentSpace", aiProcess_CalcTangentSpace },
+	{ "JoinIdenticalVertices", aiProcess_JoinIdenticalVertices },
+	{ "SplitLargeMeshes", aiProcess_SplitLargeMeshes },
+	{ "Debone", aiProcess_Debone },
+	{ "LimitBoneWeights", aiProcess_LimitBoneWeights },
+	{ "ImproveCacheLocality", aiProcess_ImproveCacheLocality },
+	{ "GenBoundingBoxes", aiProcess_GenBoundingBoxes },
+};
+
+// Flags that modify other steps rather than being steps themselves
+static constexpr unsigned int modifier_flags = aiProcess_ForceGenNormals;
+
+ImportProfile ImportProfile::fast()
+{
+	return {
+		"fast",
+		aiProcess_Triangulate |
+		aiProcess_SortByPType |
+		aiProcess_JoinIdenticalVertices |
+		aiProcess_GenNormals
+	};
+}
+
+ImportProfile ImportProfile::balanced()
+{
+	return { "balanced", aiProcessPreset_TargetRealtime_Quality };
+}
+
+ImportProfile ImportProfile::maxQuality()
+{
+	return { "max-quality", aiProcessPreset_TargetRealtime_MaxQuality };
+}
+
+ImportProfile ImportProfile::custom(unsigned int flags)
+{
+	return { "custom", flags };
+}
+
+bool ImportProfile::fromName(const std::string& name, ImportProfile& profile)
+{
+	for (auto&& candidate : { fast(), balanced(), maxQuality() }) {
+		if (candidate.name == name) {
+			profile = candidate;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+std::vector<ImportProfile::Step> ImportProfile::steps() const
+{
+	std::vector<Step> steps;
+	unsigned int modifiers = flags & modifier_flags;
+	unsigned int remaining = flags & ~modifier_flags;
+
+	for (const Step& step : pipeline_steps) {
+		if (remaining & step.flags) {
+			steps.push_back({ step.name, step.flags | modifiers });
+			remaining &= ~step.flags;
+		}
+	}
+	if (remaining) {
+		steps.push_back({ "Other", remaining | modifiers });
+	}
+
+	return steps;
+}
+
+const aiScene* ImportProfile::apply(Assimp::Importer& importer, ImportTimings& timings) const
+{
+	ImportProgressHandler* progress = dynamic_cast<ImportProgressHandler*>(importer.GetProgressHandler());
+	const aiScene* scene = importer.GetScene();
+	std::vector<Step> profile_steps = steps();
+	auto start = std::chrono::steady_clock::now();
+
+	// Combinations of flags are only validated when applied together
+	if (!importer.ValidateFlags(flags)) {
+		Assimp::DefaultLogger::get()->error("Invalid post-processing flags for profile ", name);
+		return nullptr;
+	}
+
+	timings.steps.clear();
+	for (std::size_t i = 0; scene && i < profile_steps.size(); ++i) {
+		if (progress && !progress->beginProfileStep(i, profile_steps.size())) {
+			scene = nullptr;
+			break;
+		}
+
+		auto step_start = std::chrono::steady_clock::now();
+		scene = importer.ApplyPostProcessing(profile_steps[i].flags);
+		timings.steps.push_back({
+			profile_steps[i].name,
+			std::chrono::duration<double>(std::chrono::steady_clock::now() - step_start).count()
+		});
+	}
+	timings.postprocess_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	return scene;
+}
+
+std::string ImportTimings::toString() const
+{
+	char buf[128];
+	std::string str;
+
+	std::snprintf(buf, sizeof(buf), "parse %.2f ms, post-process %.2f ms",
+		parse_seconds * 1000.0,
+		postprocess_seconds * 1000.0
+	);
+	str += buf;
+
+	const char* separator = " (";
+	for (const Step& step : steps) {
+		std::snprintf(buf, sizeof(buf), "%s%s %.2f ms", separator, step.name, step.seconds * 1000.0);
+		str += buf;
+		separator = ", ";
+	}
+	if (*separator == ',') {
+		str += ")";
+	}
+
+	std::snprintf(buf, sizeof(buf), ", convert %.2f ms", convert_seconds * 1000.0);
+	str += buf;
+
+	return str;
+}
+
+ImportProgressHandler::ImportProgressHandler(Callback callback)
+: callback(std::move(callback)),
+  postprocess(false),
+  progress(0.0f),
+  profile_step(0),
+  profile_step_count(1)
+{
+}
+
+bool ImportProgressHandler::Update(float)
+{
+	if (!callback) {
+		return true;
+	}
+	return callback(postprocess, progress);
+}
+
+void ImportProgressHandler::UpdateFileRead(int step, int step_count)
+{
+	postprocess = false;
+	progress = step_count ? static_cast<float>(step) / step_count : 0.0f;
+	Update();
+}
+
+void ImportProgressHandler::UpdatePostProcess(int step, int step_count)
+{
+	float step_progress = step_count ? static_cast<float>(step) / step_count : 0.0f;
+
+	postprocess = true;
+	progress = (profile_step + step_progress) / profile_step_count;
+	Update();
+}
+
+bool ImportProgressHandler::beginProfileStep(std::size_t step, std::size_t step_count)
+{
+	profile_step = step;
+	profile_step_count = step_count;
+
+	postprocess = true;
+	progress = static_cast<float>(step) / step_count;
+	return Update();
+}
@@ -0,0 +1,163 @@
+/**
+ * @file importprofile.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_IMPORT_PROFILE_H
+#define CORTEX_IMPORT_PROFILE_H
+
+#include <assimp/ProgressHandler.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Forward declarations
+struct aiScene;
+struct ImportTimings;
+namespace Assimp {
+class Importer;
+}
+
+/**
+ * @brief Named set of Assimp post-processing steps used for an import.
+ *
+ * All predefined profiles triangulate and sort primitives by type, such that
+ * every imported mesh has a single primitive type. Custom profiles should
+ * include @c aiProcess_SortByPType as well, because meshes with mixed
+ * primitive types are skipped.
+ */
+struct ImportProfile
+{
+	/**
+	 * @brief Single post-processing step of a profile.
+	 */
+	struct Step
+	{
+		const char* name; ///< Name of the @c aiPostProcessSteps flag without prefix
+		unsigned int flags; ///< Flags applied for this step
+	};
+
+	std::string name;
+	unsigned int flags;
+
+	/**
+	 * Split @ref flags into steps of one @c aiPostProcessSteps flag each,
+	 * in the order of Assimp's post-processing pipeline. Assimp runs
+	 * @c FindDegenerates, @c OptimizeMeshes and @c SplitLargeMeshes at two
+	 * points of the pipeline; each of them is a single step at its later
+	 * point. Modifier flags, such as @c aiProcess_ForceGenNormals, are
+	 * applied with every step. Flags without a known step are combined in a
+	 * final step named @c Other.
+	 */
+	std::vector<Step> steps() const;
+
+	/**
+	 * Apply the post-processing steps of this profile to the scene read by
+	 * @p importer, one step at a time. The duration of every step and the
+	 * total duration are recorded in @p timings. If the importer has an
+	 * @ref ImportProgressHandler, it reports the progress across all steps
+	 * and the remaining steps are skipped when it requests an abort.
+	 * @return Post-processed scene, or nullptr on failure or abort
+	 */
+	const aiScene* apply(Assimp::Importer& importer, ImportTimings& timings) const;
+
+	/**
+	 * Triangulate, sort by primitive type, join identical vertices and
+	 * generate missing flat normals. No tangents, mesh splitting or
+	 * validation.
+	 */
+	static ImportProfile fast();
+
+	/// Assimp's @c aiProcessPreset_TargetRealtime_Quality
+	static ImportProfile balanced();
+
+	/// Assimp's @c aiProcessPreset_TargetRealtime_MaxQuality
+	static ImportProfile maxQuality();
+
+	/// Custom set of @c aiPostProcessSteps flags
+	static ImportProfile custom(unsigned int flags);
+
+	/**
+	 * Find predefined profile by name. Valid names are @c fast,
+	 * @c balanced and @c max-quality.
+	 * @param name Profile name
+	 * @param profile Profile output
+	 * @return Boolean indicating whether @p name is a predefined profile
+	 */
+	static bool fromName(const std::string& name, ImportProfile& profile);
+};
+
+/**
+ * @brief Durations of the stages of an import.
+ */
+struct ImportTimings
+{
+	double parse_seconds = 0.0;
+	double postprocess_seconds = 0.0;
+	double convert_seconds = 0.0;
+
+	/// Duration of a named post-processing step
+	struct Step {
+		const char* name;
+		double seconds;
+	};
+
+	/**
+	 * Duration of every post-processing step of the import profile, in the
+	 * order applied. See @ref ImportProfile::apply().
+	 */
+	std::vector<Step> steps;
+
+	/// Format the timings as a single line for logging
+	std::string toString() const;
+};
+
+/**
+ * @brief Assimp progress handler that reports the progress of parsing and
+ *        post-processing.
+ *
+ * Post-processing progress spans all steps applied by
+ * @ref ImportProfile::apply(), although Assimp reports the progress of
+ * each step separately. The handler is owned by the Assimp importer once
+ * installed.
+ */
+class ImportProgressHandler : public Assimp::ProgressHandler
+{
+public:
+	/**
+	 * Callback invoked for every progress report, with a boolean indicating
+	 * whether post-processing is in progress and the progress within the
+	 * current stage in the range [0, 1]. Returning false requests the
+	 * importer to abort.
+	 */
+	using Callback = std::function<bool(bool postprocess, float progress)>;
+
+	/// @param callback Optional progress callback
+	explicit ImportProgressHandler(Callback callback = Callback());
+
+	bool Update(float percentage = -1.0f) override;
+	void UpdateFileRead(int step, int step_count) override;
+	void UpdatePostProcess(int step, int step_count) override;
+
+	/**
+	 * Start profile step @p step of @p step_count, which scales the
+	 * post-processing progress reported by Assimp for that step.
+	 * @return False if the importer should abort
+	 */
+	bool beginProfileStep(std::size_t step, std::size_t step_count);
+
+private:
+	Callback callback;
+	bool postprocess;
+	float progress;
+	std::size_t profile_step;
+	std::size_t profile_step_count;
+};
+
+#endif
@@ -0,0 +1,439 @@
+/**
+ * @file indexoptimizer.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "indexoptimizer.h"
+#include "mesh.h"
+
+#include <algorithm>
+#include <cmath>
+
+static constexpr unsigned int invalid_index = ~0u;
+
+/**
+ * FIFO vertex cache simulation. Each vertex records the time at which it
+ * entered the cache and the time advances on every miss, such that a vertex
+ * is cached if fewer than @c size misses occurred since.
+ */
+class FifoCache
+{
+public:
+	FifoCache(std::size_t vertex_count, std::size_t size)
+	: stamps(vertex_count, 0),
+	  size(size),
+	  time(size + 1)
+	{
+	}
+
+	/// Access vertex @p v and return whether it was a cache miss
+	bool access(unsigned int v)
+	{
+		if (time - stamps[v] <= size) {
+			return false;
+		}
+		stamps[v] = time++;
+		return true;
+	}
+
+	/// Evict all vertices
+	void flush() { time += size + 1; }
+
+private:
+	std::vector<std::size_t> stamps;
+	std::size_t size;
+	std::size_t time;
+};
+
+VertexCacheStatistics& VertexCacheStatistics::operator+=(const VertexCacheStatistics& other)
+{
+	triangle_count += other.triangle_count;
+	vertex_count += other.vertex_count;
+	vertices_transformed += other.vertices_transformed;
+	return *this;
+}
+
+VertexCacheStatistics analyzeVertexCache(
+	const unsigned int* indices,
+	std::size_t index_count,
+	std::size_t vertex_count,
+	std::size_t cache_size
+)
+{
+	VertexCacheStatistics stats;
+	FifoCache cache(vertex_count, cache_size);
+	std::vector<bool> referenced(vertex_count, false);
+
+	stats.triangle_count = index_count / 3;
+	for (std::size_t i = 0; i < stats.triangle_count * 3; ++i) {
+		unsigned int v = indices[i];
+		if (!referenced[v]) {
+			referenced[v] = true;
+			++stats.vertex_count;
+		}
+		if (cache.access(v)) {
+			++stats.vertices_transformed;
+		}
+	}
+
+	return stats;
+}
+
+void optimizeVertexCache(
+	unsigned int* destination,
+	const unsigned int* indices,
+	std::size_t index_count,
+	std::size_t vertex_count,
+	std::size_t cache_size
+)
+{
+	std::size_t triangle_count = index_count / 3;
+	std::vector<unsigned int> live(vertex_count, 0);
+	std::vector<std::size_t> offsets(vertex_count + 1, 0);
+	std::vector<unsigned int> adjacency(triangle_count * 3);
+	std::vector<std::size_t> cache_time(vertex_count, 0);
+	std::vector<bool> emitted(triangle_count, false);
+	std::vector<unsigned int> dead_end;
+	std::vector<unsigned int> candidates;
+	std::size_t time = cache_size + 1;
+	std::size_t cursor = 0;
+	std::size_t out = 0;
+
+	// Triangles adjacent to each vertex, in compressed row storage
+	for (std::size_t i = 0; i < triangle_count * 3; ++i) {
+		++live[indices[i]];
+	}
+	for (std::size_t v = 0; v < vertex_count; ++v) {
+		offsets[v + 1] = offsets[v] + live[v];
+	}
+	{
+		std::vector<std::size_t> fill(offsets.begin(), offsets.end() - 1);
+		for (std::size_t i = 0; i < triangle_count * 3; ++i) {
+			adjacency[fill[indices[i]]++] = static_cast<unsigned int>(i / 3);
+		}
+	}
+	dead_end.reserve(triangle_count * 3);
+
+	// Find next vertex with remaining triangles, preferring recently
+	// emitted vertices over the input order
+	auto skipDeadEnd = [&]() -> unsigned int {
+		while (!dead_end.empty()) {
+			unsigned int v = dead_end.back();
+			dead_end.pop_back();
+			if (live[v]) {
+				return v;
+			}
+		}
+		for (; cursor < vertex_count; ++cursor) {
+			if (live[cursor]) {
+				return static_cast<unsigned int>(cursor);
+			}
+		}
+		return invalid_index;
+	};
+
+	unsigned int fanning = skipDeadEnd();
+	while (fanning != invalid_index) {
+		candidates.clear();
+
+		// Emit all remaining triangles of the fanning vertex
+		for (std::size_t k = offsets[fanning]; k < offsets[fanning + 1]; ++k) {
+			unsigned int t = adjacency[k];
+			if (emitted[t]) {
+				continue;
+			}
+			emitted[t] = true;
+
+			for (std::size_t c = 0; c < 3; ++c) {
+				unsigned int v = indices[t * 3 + c];
+				destination[out++] = v;
+				dead_end.push_back(v);
+				candidates.push_back(v);
+				--live[v];
+				if (time - cache_time[v] > cache_size) {
+					cache_time[v] = time++;
+				}
+			}
+		}
+
+		// Select the candidate that stays in the cache for all of its
+		// remaining triangles and entered the cache earliest. Candidates
+		// that would leave the cache have priority 0 and are never
+		// selected; the dead-end stack is used instead.
+		unsigned int next = invalid_index;
+		std::ptrdiff_t best_priority = 0;
+		for (unsigned int v : candidates) {
+			if (!live[v]) {
+				continue;
+			}
+
+			std::ptrdiff_t priority = 0;
+			if (time - cache_time[v] + 2 * live[v] <= cache_size) {
+				priority = static_cast<std::ptrdiff_t>(time - cache_time[v]);
+			}
+			if (priority > best_priority) {
+				best_priority = priority;
+				next = v;
+			}
+		}
+
+		fanning = next != invalid_index ? next : skipDeadEnd();
+	}
+}
+
+void optimizeOverdraw(
+	unsigned int* destination,
+	const unsigned int* indices,
+	std::size_t index_count,
+	const float* positions,
+	std::size_t vertex_count,
+	std::size_t stride,
+	float threshold,
+	std::size_t cache_size
+)
+{
+	struct Cluster {
+		std::size_t begin;
+		std::size_t end;
+		float sort_key;
+	};
+
+	std::size_t triangle_count = index_count / 3;
+	std::vector<std::size_t> hard_boundaries;
+	std::vector<Cluster> clusters;
+	FifoCache cache(vertex_count, cache_size);
+
+	if (!triangle_count) {
+		return;
+	}
+
+	// Hard boundaries at triangles that miss for all vertices, which occur
+	// where the cache optimizer started a new fan sequence
+	for (std::size_t t = 0; t < triangle_count; ++t) {
+		unsigned int misses = 0;
+		for (std::size_t c = 0; c < 3; ++c) {
+			misses += cache.access(indices[t * 3 + c]);
+		}
+		if (t == 0 || misses == 3) {
+			hard_boundaries.push_back(t);
+		}
+	}
+	hard_boundaries.push_back(triangle_count);
+
+	// Split hard clusters where the cache miss ratio of the prefix remains
+	// within the threshold of the whole hard cluster
+	for (std::size_t h = 0; h + 1 < hard_boundaries.size(); ++h) {
+		std::size_t begin = hard_boundaries[h];
+		std::size_t end = hard_boundaries[h + 1];
+
+		cache.flush();
+		std::size_t cluster_misses = 0;
+		for (std::size_t i = begin * 3; i < end * 3; ++i) {
+			cluster_misses += cache.access(indices[i]);
+		}
+		float cluster_acmr = float(cluster_misses) / (end - begin);
+
+		cache.flush();
+		std::size_t soft_begin = begin;
+		std::size_t soft_misses = 0;
+		for (std::size_t t = begin; t < end; ++t) {
+			for (std::size_t c = 0; c < 3; ++c) {
+				soft_misses += cache.access(indices[t * 3 + c]);
+			}
+
+			float soft_acmr = float(soft_misses) / (t + 1 - soft_begin);
+			if (t + 1 < end && soft_acmr <= threshold * cluster_acmr) {
+				clusters.push_back({ soft_begin, t + 1, 0.0f });
+				soft_begin = t + 1;
+				soft_misses = 0;
+				cache.flush();
+			}
+		}
+		clusters.push_back({ soft_begin, end, 0.0f });
+	}
+
+	// Area weighted centroid and normal of each cluster and of the mesh
+	float mesh_centroid[3] = { 0.0f, 0.0f, 0.0f };
+	float mesh_area = 0.0f;
+	std::vector<float> cluster_data(clusters.size() * 6, 0.0f);
+	for (std::size_t k = 0; k < clusters.size(); ++k) {
+		float* centroid = &cluster_data[k * 6];
+		float* normal = centroid + 3;
+		float area = 0.0f;
+
+		for (std::size_t t = clusters[k].begin; t < clusters[k].end; ++t) {
+			const float* p0 = positions + indices[t * 3 + 0] * stride;
+			const float* p1 = positions + indices[t * 3 + 1] * stride;
+			const float* p2 = positions + indices[t * 3 + 2] * stride;
+			float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+			float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+			float n[3] = {
+				e1[1] * e2[2] - e1[2] * e2[1],
+				e1[2] * e2[0] - e1[0] * e2[2],
+				e1[0] * e2[1] - e1[1] * e2[0],
+			};
+			float a = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+			for (std::size_t c = 0; c < 3; ++c) {
+				centroid[c] += (p0[c] + p1[c] + p2[c]) / 3.0f * a;
+				normal[c] += n[c];
+			}
+			area += a;
+		}
+
+		for (std::size_t c = 0; c < 3; ++c) {
+			mesh_centroid[c] += centroid[c];
+			if (area > 0.0f) {
+				centroid[c] /= area;
+			}
+		}
+		mesh_area += area;
+	}
+	if (mesh_area > 0.0f) {
+		for (std::size_t c = 0; c < 3; ++c) {
+			mesh_centroid[c] /= mesh_area;
+		}
+	}
+
+	// Clusters far out along their normal are likely to occlude others
+	for (std::size_t k = 0; k < clusters.size(); ++k) {
+		const float* centroid = &cluster_data[k * 6];
+		const float* normal = centroid + 3;
+		float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+		float key = 0.0f;
+
+		if (length > 0.0f) {
+			for (std::size_t c = 0; c < 3; ++c) {
+				key += (centroid[c] - mesh_centroid[c]) * normal[c];
+			}
+			key /= length;
+		}
+		clusters[k].sort_key = key;
+	}
+	std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) {
+		return a.sort_key > b.sort_key;
+	});
+
+	std::size_t out = 0;
+	for (auto&& cluster : clusters) {
+		for (std::size_t i = cluster.begin * 3; i < cluster.end * 3; ++i) {
+			destination[out++] = indices[i];
+		}
+	}
+}
+
+std::size_t optimizeVertexFetchRemap(
+	unsigned int* remap,
+	const unsigned int* indices,
+	std::size_t index_count,
+	std::size_t vertex_count
+)
+{
+	unsigned int next = 0;
+
+	std::fill(remap, remap + vertex_count, invalid_index);
+	for (std::size_t i = 0; i < index_count; ++i) {
+		unsigned int& v = remap[indices[i]];
+		if (v == invalid_index) {
+			v = next++;
+		}
+	}
+
+	return next;
+}
+
+std::size_t optimizeTriangleList(
+	std::vector<unsigned int>& indices,
+	const float* positions,
+	std::size_t vertex_count,
+	std::size_t stride,
+	std::vector<unsigned int>& remap,
+	VertexCacheStatistics* before,
+	VertexCacheStatistics* after
+)
+{
+	// Only complete triangles are retained
+	std::size_t index_count = indices.size() / 3 * 3;
+	std::vector<unsigned int> scratch(index_count);
+
+	indices.resize(index_count);
+	if (before) {
+		*before = analyzeVertexCache(indices.data(), index_count, vertex_count);
+	}
+
+	optimizeVertexCache(scratch.data(), indices.data(), index_count, vertex_count);
+	optimizeOverdraw(indices.data(), scratch.data(), index_count, positions, vertex_count, stride);
+
+	remap.resize(vertex_count);
+	std::size_t remapped_count = optimizeVertexFetchRemap(remap.data(), indices.data(), index_count, vertex_count);
+	for (auto&& index : indices) {
+		index = remap[index];
+	}
+
+	if (after) {
+		*after = analyzeVertexCache(indices.data(), index_count, remapped_count);
+	}
+
+	return remapped_count;
+}
+
+bool optimizeMesh(Mesh* mesh, VertexCacheStatistics* before, VertexCacheStatistics* after)
+{
+	if (mesh->indexData() != mesh->index_data.data()) {
+		return false;
+	}
+
+	// Optimize a scratch copy and write it back; the count never grows
+	std::vector<unsigned int> indices(mesh->index_data.begin(), mesh->index_data.end());
+	if (!optimizeMesh(mesh, indices, before, after)) {
+		return false;
+	}
+	mesh->index_data.assign(indices.begin(), indices.end());
+
+	return true;
+}
+
+bool optimizeMesh(
+	Mesh* mesh,
+	std::vector<unsigned int>& indices,
+	VertexCacheStatistics* before,
+	VertexCacheStatistics* after
+)
+{
+	if (mesh->primitive_type != Mesh::PrimitiveType::Triangle ||
+		mesh->vertexData() != mesh->vertex_data.data() ||
+		!mesh->lods.empty()
+	) {
+		return false;
+	}
+
+	std::size_t stride = mesh->stride;
+	std::size_t vertex_count = mesh->vertex_data.size() / stride;
+	std::vector<unsigned int> remap;
+
+	std::size_t remapped_count = optimizeTriangleList(
+		indices,
+		mesh->vertex_data.data(),
+		vertex_count,
+		stride,
+		remap,
+		before,
+		after
+	);
+
+	// Move vertices from a scratch copy back into the vertex data, which
+	// only shrinks by the unreferenced vertices
+	std::vector<float> vertex_data(mesh->vertex_data.begin(), mesh->vertex_data.end());
+	for (std::size_t v = 0; v < vertex_count; ++v) {
+		if (remap[v] != invalid_index) {
+			std::copy_n(&vertex_data[v * stride], stride, &mesh->vertex_data[remap[v] * stride]);
+		}
+	}
+	mesh->vertex_data.resize(remapped_count * stride);
+
+	return true;
+}
@@ -0,0 +1,211 @@
+/**
+ * @file indexoptimizer.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_INDEX_OPTIMIZER_H
+#define CORTEX_INDEX_OPTIMIZER_H
+
+#include <cstddef>
+#include <vector>
+
+// Forward declaration
+class Mesh;
+
+/// Post-transform vertex cache size assumed by the optimizer
+constexpr std::size_t default_vertex_cache_size = 16;
+
+/**
+ * @brief Post-transform vertex cache statistics of a triangle list.
+ *
+ * Counts are kept such that the statistics of several meshes can be
+ * accumulated using @ref operator+=.
+ */
+struct VertexCacheStatistics
+{
+	std::size_t triangle_count = 0;
+	std::size_t vertex_count = 0; ///< Number of referenced vertices
+	std::size_t vertices_transformed = 0; ///< Number of cache misses
+
+	/// Average cache miss ratio; transformed vertices per triangle
+	float acmr() const { return triangle_count ? float(vertices_transformed) / triangle_count : 0.0f; }
+
+	/// Average transform to vertex ratio; 1.0 is optimal
+	float atvr() const { return vertex_count ? float(vertices_transformed) / vertex_count : 0.0f; }
+
+	VertexCacheStatistics& operator+=(const VertexCacheStatistics& other);
+};
+
+/**
+ * @brief Simulate a FIFO post-transform vertex cache of @p cache_size
+ *        entries for triangle list @p indices.
+ */
+VertexCacheStatistics analyzeVertexCache(
+	const unsigned int* indices,
+	std::size_t index_count,
+	std::size_t vertex_count,
+	std::size_t cache_size = default_vertex_cache_size
+);
+
+/**
+ * @brief Reorder triangles for post-transform vertex cache efficiency using
+ *        Tipsify (Sander, Nehab and Barczak, 2007).
+ *
+ * Tipsify fans around each vertex and picks the next fanning vertex from
+ * the vertices that are still in the cache, in linear time.
+ *
+ * @param destination Reordered triangle list output. Must not overlap
+ *                    @p indices.
+ * @param indices Triangle list
+ * @param index_count Number of indices. Trailing partial triangles are
+ *                    ignored.
+ * @param vertex_count Number of vertices referenced by @p indices
+ * @param cache_size Vertex cache size
+ */
+void optimizeVertexCache(
+	unsigned int* destination,
+	const unsigned int* indices,
+	std::size_t index_count,
+	std::size_t vertex_count,
+	std::size_t cache_size = default_vertex_cache_size
+);
+
+/**
+ * @brief Reorder clusters of triangles to reduce overdraw, without
+ *        significantly degrading vertex cache efficiency.
+ *
+ * The triangle list, which should already be optimized using
+ * @ref optimizeVertexCache, is split into clusters at cache flushes and
+ * where the cluster cache miss ratio is within @p threshold of the
+ * unsplit cluster. The clusters are then sorted such that outward facing
+ * clusters, which are likely to occlude others, are drawn first.
+ *
+ * @param destination Reordered triangle list output. Must not overlap
+ *                    @p indices.
+ * @param indices Triangle list
+ * @param index_count Number of indices
+ * @param positions Vertex positions; the x,y,z floats of vertex @p i are at
+ *                  @p positions + @p i * @p stride
+ * @param vertex_count Number of vertices
+ * @param stride Position stride in floats. Must be >= 3.
+ * @param threshold Permitted cache miss ratio degradation, e.g. 1.05
+ * @param cache_size Vertex cache size
+ */
+void optimizeOverdraw(
+	unsigned int* destination,
+	const unsigned int* indices,
+	std::size_t index_count,
+	const float* positions,
+	std::size_t vertex_count,
+	std::size_t stride,
+	float threshold = 1.05f,
+	std::size_t cache_size = default_vertex_cache_size
+);
+
+/**
+ * @brief Compute vertex remap table that places vertices in order of first
+ *        use by @p indices, for vertex fetch locality.
+ *
+ * @param remap Remap table output of @p vertex_count entries. Unreferenced
+ *              vertices are mapped to ~0u.
+ * @param indices Triangle list
+ * @param index_count Number of indices
+ * @param vertex_count Number of vertices
+ * @return Number of referenced vertices
+ */
+std::size_t optimizeVertexFetchRemap(
+	unsigned int* remap,
+	const unsigned int* indices,
+	std::size_t index_count,
+	std::size_t vertex_count
+);
+
+/**
+ * @brief Optimize triangle list for vertex cache, overdraw and vertex fetch,
+ *        in that order.
+ *
+ * The indices are rewritten in place to refer to the remapped vertices. The
+ * caller must move vertex @p i to position @p remap[i] and drop vertices
+ * that are mapped to ~0u.
+ *
+ * @param indices Triangle list to optimize
+ * @param positions See @ref optimizeOverdraw
+ * @param vertex_count Number of vertices
+ * @param stride See @ref optimizeOverdraw
+ * @param remap Vertex remap output
+ * @param before Optional statistics output of the original triangle list
+ * @param after Optional statistics output of the optimized triangle list
+ * @return Number of remapped vertices
+ */
+std::size_t optimizeTriangleList(
+	std::vector<unsigned int>& indices,
+	const float* positions,
+	std::size_t vertex_count,
+	std::size_t stride,
+	std::vector<unsigned int>& remap,
+	VertexCacheStatistics* before = nullptr,
+	VertexCacheStatistics* after = nullptr
+);
+
+/**
+ * @brief Optimize triangle mesh in place using @ref optimizeTriangleList.
+ *
+ * The work is done in scratch space and the results are written back into
+ * the vertex and index data of @p mesh, which never grow, such that their
+ * arena storage is reused.
+ *
+ * @return Boolean indicating whether @p mesh was optimized. Meshes that are
+ *         not triangle meshes, or that refer to external data, or that
+ *         have levels of detail, are not.
+ */
+bool optimizeMesh(Mesh* mesh, VertexCacheStatistics* before = nullptr, VertexCacheStatistics* after = nullptr);
+
+/**
+ * @brief Optimize triangle list @p indices of triangle mesh @p mesh, which
+ *        is kept in scratch space instead of @ref Mesh::index_data, and
+ *        reorder the vertex data of @p mesh in place accordingly.
+ *
+ * Intended for loaders that store the indices of all levels of detail at
+ * once using @ref buildLods(Mesh*, const std::vector<unsigned int>&, const std::vector<float>&).
+ *
+ * @return See above. The index data of @p mesh is ignored.
+ */
+bool optimizeMesh(
+	Mesh* mesh,
+	std::vector<unsigned int>& indices,
+	VertexCacheStatistics* before = nullptr,
+	VertexCacheStatistics* after = nullptr
+);
+
+/**
+ * @brief Optimize tessellated triangle mesh in place using
+ *        @ref optimizeTriangleList.
+ *
+ * Intended for the output of the tessellators, after tessellation. Do not
+ * use it for index data shared by @ref TopologyCache.
+ *
+ * @tparam VertexBuffer Either @c std::vector of a vertex type or a
+ *                      @ref SplitVertexBuffer. The position type must
+ *                      provide float components using @c operator[], e.g.
+ *                      @c glm::vec3.
+ *
+ * @param vertices Vertex buffer to reorder
+ * @param indices Triangle list to optimize
+ * @param before Optional statistics output of the original triangle list
+ * @param after Optional statistics output of the optimized triangle list
+ */
+template<typename VertexBuffer>
+void optimizeMesh(
+	VertexBuffer& vertices,
+	std::vector<unsigned int>& indices,
+	VertexCacheStatistics* before = nullptr,
+	VertexCacheStatistics* after = nullptr
+);
+
+#include "indexoptimizer.tcc"
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * @file indexoptimizer.tcc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "indexoptimizer.h"
+
+#ifndef CORTEX_INDEX_OPTIMIZER_TCC
+#define CORTEX_INDEX_OPTIMIZER_TCC
+
+#include "vertex_buffer.h"
+
+namespace detail {
+
+template<typename T>
+std::vector<T> remapVertices(const std::vector<T>& vertices, const std::vector<unsigned int>& remap, std::size_t count)
+{
+	std::vector<T> result(count);
+	for (std::size_t i = 0; i < vertices.size(); ++i) {
+		if (remap[i] != ~0u) {
+			result[remap[i]] = vertices[i];
+		}
+	}
+	return result;
+}
+
+template<typename VertexType>
+const auto& vertexPosition(const std::vector<VertexType>& vertices, std::size_t i)
+{
+	return vertices[i].position;
+}
+
+template<typename PositionType, typename AttributeType>
+const auto& vertexPosition(const SplitVertexBuffer<PositionType, AttributeType>& vertices, std::size_t i)
+{
+	return vertices.positions[i];
+}
+
+template<typename VertexType>
+void remapVertexBuffer(std::vector<VertexType>& vertices, const std::vector<unsigned int>& remap, std::size_t count)
+{
+	vertices = remapVertices(vertices, remap, count);
+}
+
+template<typename PositionType, typename AttributeType>
+void remapVertexBuffer(SplitVertexBuffer<PositionType, AttributeType>& vertices, const std::vector<unsigned int>& remap, std::size_t count)
+{
+	vertices.positions = remapVertices(vertices.positions, remap, count);
+	vertices.attributes = remapVertices(vertices.attributes, remap, count);
+}
+
+} // namespace detail
+
+template<typename VertexBuffer>
+void optimizeMesh(
+	VertexBuffer& vertices,
+	std::vector<unsigned int>& indices,
+	VertexCacheStatistics* before,
+	VertexCacheStatistics* after
+)
+{
+	std::size_t vertex_count = vertices.size();
+	std::vector<float> positions;
+	std::vector<unsigned int> remap;
+
+	positions.reserve(vertex_count * 3);
+	for (std::size_t i = 0; i < vertex_count; ++i) {
+		const auto& position = detail::vertexPosition(vertices, i);
+		positions.push_back(position[0]);
+		positions.push_back(position[1]);
+		positions.push_back(position[2]);
+	}
+
+	std::size_t remapped_count = optimizeTriangleList(indices, positions.data(), vertex_count, 3, remap, before, after);
+	detail::remapVertexBuffer(vertices, remap, remapped_count);
+}
+
+#endif
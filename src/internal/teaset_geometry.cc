@@ -1,12 +1,143 @@
 /**
  * @file teaset_geometry.cc
  *
- * Copyright (c) 2013 Leon Lynch
+ * Copyright (c) 2013, 2026 Leon Lynch
  *
  * This file is licensed under the terms of the MIT license.
  * See LICENSE file.
  */
 
+#include "teaset.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+// The raw data below is parsed at compile time into the patch tables used
+// by Teaset, such that constructing a teaset requires no runtime parsing.
+// The format is a patch count, followed by one line of 16 comma separated
+// one-based control point indices per patch, followed by a control point
+// count and one line of comma separated x,y,z coordinates per control
+// point.
+
+namespace {
+
+constexpr bool is_digit(char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+// Advance to the next number, skipping whitespace and separators
+constexpr const char* skip_separators(const char* p)
+{
+	while (*p && !is_digit(*p) && *p != '-') {
+		++p;
+	}
+	return p;
+}
+
+constexpr std::size_t parse_uint(const char*& p)
+{
+	p = skip_separators(p);
+	std::size_t value = 0;
+	while (is_digit(*p)) {
+		value = value * 10 + (*p - '0');
+		++p;
+	}
+	return value;
+}
+
+constexpr float parse_float(const char*& p)
+{
+	p = skip_separators(p);
+	bool negative = false;
+	if (*p == '-') {
+		negative = true;
+		++p;
+	}
+
+	// Accumulate all digits as an exact integer and scale once to limit
+	// rounding error
+	unsigned long long mantissa = 0;
+	double scale = 1.0;
+	while (is_digit(*p)) {
+		mantissa = mantissa * 10 + (*p - '0');
+		++p;
+	}
+	if (*p == '.') {
+		++p;
+		while (is_digit(*p)) {
+			mantissa = mantissa * 10 + (*p - '0');
+			scale *= 10.0;
+			++p;
+		}
+	}
+
+	double value = static_cast<double>(mantissa) / scale;
+	return static_cast<float>(negative ? -value : value);
+}
+
+constexpr std::size_t patch_count(const char* data)
+{
+	return parse_uint(data);
+}
+
+constexpr std::size_t vertex_count(const char* data)
+{
+	std::size_t count = parse_uint(data);
+	for (std::size_t i = 0; i < count * 16; ++i) {
+		parse_uint(data);
+	}
+	return parse_uint(data);
+}
+
+template<std::size_t PatchCount, std::size_t VertexCount>
+struct teaset_tables_t
+{
+	std::array<Teaset::ControlPoint, VertexCount> control_points;
+	std::array<Teaset::PatchData, PatchCount> patches;
+
+	constexpr Teaset::Geometry geometry() const
+	{
+		return { control_points.data(), control_points.size(), patches.data(), patches.size() };
+	}
+};
+
+template<std::size_t PatchCount, std::size_t VertexCount>
+constexpr teaset_tables_t<PatchCount, VertexCount> parse_tables(const char* data, bool data_is_ccw)
+{
+	teaset_tables_t<PatchCount, VertexCount> tables{};
+
+	// read indices and convert to zero-based indices in BezierPatch order
+	parse_uint(data);
+	for (std::size_t i = 0; i < PatchCount; ++i) {
+		for (std::size_t j = 0; j < 16; ++j) {
+			std::size_t index = parse_uint(data);
+			if (index < 1 || index > VertexCount) {
+				// Not a constant expression; fails the build
+				throw std::out_of_range("Invalid teaset control point index");
+			}
+
+			std::size_t column = data_is_ccw ? j % 4 : 3 - (j % 4);
+			tables.patches[i].k[j / 4][column] = static_cast<std::uint32_t>(index - 1);
+		}
+	}
+
+	// read vertices
+	parse_uint(data);
+	for (std::size_t i = 0; i < VertexCount; ++i) {
+		Teaset::ControlPoint& k = tables.control_points[i];
+		k.x = parse_float(data);
+		k.y = parse_float(data);
+		k.z = parse_float(data);
+	}
+
+	return tables;
+}
+
+} // namespace
+
 // This is the raw data from the original dataset
 // at http://www.sjbaker.org/teapot/teaset.tgz
 
@@ -17,7 +148,7 @@
 // 8 patches for the lid
 // 4 patches for the bottom
 
-extern const char teapot_geometry_str[] = R"(
+static constexpr char teapot_geometry_str[] = R"(
 32
 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16
 4,17,18,19,8,20,21,22,12,23,24,25,16,26,27,28
@@ -360,7 +491,7 @@ extern const char teapot_geometry_str[] = R"(
 1.425,-0.798,0.0
 )";
 
-extern const char teacup_geometry_str[] = R"(
+static constexpr char teacup_geometry_str[] = R"(
 26
 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16
 4,17,18,19,8,20,21,22,12,23,24,25,16,26,27,28
@@ -642,7 +773,7 @@ extern const char teacup_geometry_str[] = R"(
 -0.409091,0.363636,0.0454545
 )";
 
-extern const char teaspoon_geometry_str[] = R"(
+static constexpr char teaspoon_geometry_str[] = R"(
 16
 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16
 17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32
@@ -918,3 +1049,20 @@ extern const char teaspoon_geometry_str[] = R"(
 -0.000535714,-1,0.0178571
 -0.000357143,-1,0.0178571
 )";
+
+static constexpr auto teapot_tables = parse_tables<
+	patch_count(teapot_geometry_str),
+	vertex_count(teapot_geometry_str)
+>(teapot_geometry_str, false);
+static constexpr auto teacup_tables = parse_tables<
+	patch_count(teacup_geometry_str),
+	vertex_count(teacup_geometry_str)
+>(teacup_geometry_str, true);
+static constexpr auto teaspoon_tables = parse_tables<
+	patch_count(teaspoon_geometry_str),
+	vertex_count(teaspoon_geometry_str)
+>(teaspoon_geometry_str, true);
+
+extern const Teaset::Geometry teapot_geometry = teapot_tables.geometry();
+extern const Teaset::Geometry teacup_geometry = teacup_tables.geometry();
+extern const Teaset::Geometry teaspoon_geometry = teaspoon_tables.geometry();
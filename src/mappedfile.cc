@@ -0,0 +1,77 @@
+/**
+ * @file mappedfile.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "mappedfile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile()
+: fd(-1),
+  addr(nullptr),
+  length(0)
+{
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+bool MappedFile::open(const std::string& filename, bool sequential)
+{
+	struct stat st;
+
+	close();
+
+	fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return false;
+	}
+
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+		close();
+		return false;
+	}
+
+	length = static_cast<std::size_t>(st.st_size);
+	if (!length) {
+		// mmap() does not accept empty mappings
+		return true;
+	}
+
+	addr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (addr == MAP_FAILED) {
+		addr = nullptr;
+		close();
+		return false;
+	}
+
+	if (sequential) {
+		madvise(addr, length, MADV_SEQUENTIAL);
+		madvise(addr, length, MADV_WILLNEED);
+	}
+
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (addr) {
+		munmap(addr, length);
+		addr = nullptr;
+	}
+	if (fd >= 0) {
+		::close(fd);
+		fd = -1;
+	}
+	length = 0;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file mappedfile.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_MAPPED_FILE_H
+#define CORTEX_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The mapping is private and remains valid until @ref close is called or
+ * the object is destroyed. Empty files can be opened but have no data.
+ */
+class MappedFile
+{
+public:
+	MappedFile();
+	virtual ~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/**
+	 * @brief Map file @p filename.
+	 *
+	 * Any previous mapping is closed first.
+	 *
+	 * @param filename File to map
+	 * @param sequential Advise the kernel that the file will be read
+	 *                   sequentially, enabling aggressive read-ahead.
+	 * @return Boolean indicating success
+	 */
+	bool open(const std::string& filename, bool sequential = true);
+
+	/**
+	 * @brief Unmap file, if mapped.
+	 */
+	void close();
+
+	bool isOpen() const { return fd >= 0; }
+	const char* data() const { return static_cast<const char*>(addr); }
+	std::size_t size() const { return length; }
+
+private:
+	int fd;
+	void* addr;
+	std::size_t length;
+};
+
+#endif
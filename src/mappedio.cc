@@ -0,0 +1,115 @@
+/**
+ * @file mappedio.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "mappedio.h"
+#include "mappedfile.h"
+
+#include <cstring>
+
+#include <sys/stat.h>
+
+MappedIOStream::MappedIOStream(std::shared_ptr<const MappedFile> file)
+: file(std::move(file)),
+  base(this->file->data()),
+  length(this->file->size()),
+  position(0)
+{
+}
+
+MappedIOStream::~MappedIOStream()
+{
+}
+
+std::size_t MappedIOStream::Read(void* buffer, std::size_t size, std::size_t count)
+{
+	if (!size || !count) {
+		return 0;
+	}
+
+	// Only complete elements are read, like fread()
+	std::size_t available = (length - position) / size;
+	if (count > available) {
+		count = available;
+	}
+	if (!count) {
+		return 0;
+	}
+
+	std::memcpy(buffer, base + position, size * count);
+	position += size * count;
+	return count;
+}
+
+std::size_t MappedIOStream::Write(const void*, std::size_t, std::size_t)
+{
+	return 0;
+}
+
+aiReturn MappedIOStream::Seek(std::size_t offset, aiOrigin origin)
+{
+	std::size_t new_position;
+
+	switch (origin) {
+		case aiOrigin_SET: new_position = offset; break;
+		case aiOrigin_CUR: new_position = position + offset; break;
+		case aiOrigin_END: new_position = length - offset; break;
+		default: return aiReturn_FAILURE;
+	}
+
+	// Offsets are unsigned; overflow wraps beyond the file size as well
+	if (new_position > length) {
+		return aiReturn_FAILURE;
+	}
+
+	position = new_position;
+	return aiReturn_SUCCESS;
+}
+
+MappedIOSystem::MappedIOSystem()
+{
+}
+
+MappedIOSystem::~MappedIOSystem()
+{
+}
+
+bool MappedIOSystem::Exists(const char* filename) const
+{
+	struct stat st;
+
+	accessed_files.insert(filename);
+	if (files.count(filename)) {
+		return true;
+	}
+	return stat(filename, &st) == 0 && S_ISREG(st.st_mode);
+}
+
+Assimp::IOStream* MappedIOSystem::Open(const char* filename, const char* mode)
+{
+	if (std::strchr(mode, 'w') || std::strchr(mode, 'a') || std::strchr(mode, '+')) {
+		return nullptr;
+	}
+
+	accessed_files.insert(filename);
+	auto itr = files.find(filename);
+	if (itr == files.end()) {
+		std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>();
+		if (!file->open(filename, true)) {
+			return nullptr;
+		}
+		itr = files.emplace(filename, std::move(file)).first;
+	}
+
+	return new MappedIOStream(itr->second);
+}
+
+void MappedIOSystem::Close(Assimp::IOStream* stream)
+{
+	delete stream;
+}
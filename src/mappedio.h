@@ -0,0 +1,85 @@
+/**
+ * @file mappedio.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_MAPPED_IO_H
+#define CORTEX_MAPPED_IO_H
+
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+// Forward declaration
+class MappedFile;
+
+/**
+ * @brief Assimp stream reading from a memory-mapped file.
+ *
+ * Reads copy directly from the mapping without intermediate buffering and
+ * seeks only move the stream position.
+ */
+class MappedIOStream : public Assimp::IOStream
+{
+public:
+	explicit MappedIOStream(std::shared_ptr<const MappedFile> file);
+	~MappedIOStream() override;
+
+	std::size_t Read(void* buffer, std::size_t size, std::size_t count) override;
+	std::size_t Write(const void* buffer, std::size_t size, std::size_t count) override;
+	aiReturn Seek(std::size_t offset, aiOrigin origin) override;
+	std::size_t Tell() const override { return position; }
+	std::size_t FileSize() const override { return length; }
+	void Flush() override {}
+
+	/// Mapped file content, for readers that can use it without copying
+	const char* data() const { return base; }
+
+private:
+	std::shared_ptr<const MappedFile> file;
+	const char* base;
+	std::size_t length;
+	std::size_t position;
+};
+
+/**
+ * @brief Assimp file system that memory-maps every file opened for reading.
+ *
+ * The main file and any referenced sub-files, such as OBJ material libraries
+ * and glTF buffers, are resolved by Assimp through this file system. Each
+ * file is mapped once, with sequential access advice, and the mapping is
+ * shared by all streams that open the same file until the file system is
+ * destroyed. Files cannot be opened for writing.
+ *
+ * Every file name that Assimp checks or opens is recorded, including files
+ * that do not exist, such that the inputs of an import can be tracked.
+ */
+class MappedIOSystem : public Assimp::IOSystem
+{
+public:
+	MappedIOSystem();
+	~MappedIOSystem() override;
+
+	bool Exists(const char* filename) const override;
+	char getOsSeparator() const override { return '/'; }
+	Assimp::IOStream* Open(const char* filename, const char* mode = "rb") override;
+	void Close(Assimp::IOStream* stream) override;
+
+	/// Names of all files checked or opened, whether or not they exist
+	const std::set<std::string>& accessedFiles() const { return accessed_files; }
+
+private:
+	std::map<std::string, std::shared_ptr<const MappedFile>> files;
+	mutable std::set<std::string> accessed_files;
+};
+
+#endif
@@ -1,7 +1,7 @@
 /**
  * @file material.cc
  *
- * Copyright (c) 2013 Leon Lynch
+ * Copyright (c) 2013, 2026 Leon Lynch
  *
  * This file is licensed under the terms of the MIT license.
  * See LICENSE file.
@@ -9,6 +9,15 @@
 
 #include "material.h"
 
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<Material>::value &&
+	std::is_standard_layout<Material>::value,
+	"Material must be plain data"
+);
+
 Material::color3_t::color3_t(float r, float g, float b)
 : r(r),
   g(g),
@@ -27,10 +36,6 @@ Material::Material()
 {
 }
 
-Material::~Material()
-{
-}
-
 void Material::setDefaultShadingMode()
 {
 	static const float epsilon = 10e-3f;
@@ -43,3 +48,53 @@ void Material::setDefaultShadingMode()
 		shading_mode = ShadingMode::BlinnPhong;
 	}
 }
+
+// 64-bit FNV-1a hash of each field, which excludes padding
+static void hashBytes(std::uint64_t& hash, const void* data, std::size_t size)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	for (std::size_t i = 0; i < size; ++i) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3;
+	}
+}
+
+static void hashFloat(std::uint64_t& hash, float value)
+{
+	// Adding zero turns negative zero into zero, which compares equal
+	value += 0.0f;
+	hashBytes(hash, &value, sizeof(value));
+}
+
+std::uint64_t Material::hash() const
+{
+	std::uint64_t hash = 0xcbf29ce484222325;
+	unsigned char flags = (twosided ? 0x01 : 0) | (wireframe ? 0x02 : 0);
+	std::uint32_t mode = static_cast<std::uint32_t>(shading_mode);
+
+	hashBytes(hash, &flags, sizeof(flags));
+	hashBytes(hash, &mode, sizeof(mode));
+	for (const color3_t* color : { &ambient, &diffuse, &specular }) {
+		hashFloat(hash, color->r);
+		hashFloat(hash, color->g);
+		hashFloat(hash, color->b);
+	}
+	hashFloat(hash, shininess);
+
+	return hash;
+}
+
+bool Material::operator==(const Material& other) const
+{
+	auto equal = [](const color3_t& a, const color3_t& b) {
+		return a.r == b.r && a.g == b.g && a.b == b.b;
+	};
+
+	return twosided == other.twosided &&
+		shading_mode == other.shading_mode &&
+		wireframe == other.wireframe &&
+		equal(ambient, other.ambient) &&
+		equal(diffuse, other.diffuse) &&
+		equal(specular, other.specular) &&
+		shininess == other.shininess;
+}
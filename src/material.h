@@ -1,7 +1,7 @@
 /**
  * @file material.h
  *
- * Copyright (c) 2013 Leon Lynch
+ * Copyright (c) 2013, 2026 Leon Lynch
  *
  * This file is licensed under the terms of the MIT license.
  * See LICENSE file.
@@ -11,7 +11,15 @@
 #define CORTEX_MATERIAL
 
 #include <cmath>
+#include <cstdint>
 
+/**
+ * @brief Plain material parameters.
+ *
+ * Materials are trivially copyable values that are interned by
+ * @ref MaterialTable, such that equal materials are stored once and can be
+ * uploaded as a single contiguous buffer.
+ */
 class Material
 {
 public:
@@ -47,12 +55,14 @@ public:
 
 public:
 	Material();
-	virtual ~Material();
-
-	Material(const Material&) = delete;
-	Material& operator=(const Material&) = delete;
 
 	void setDefaultShadingMode();
+
+	/// Content hash; equal materials have equal hashes
+	std::uint64_t hash() const;
+
+	bool operator==(const Material& other) const;
+	bool operator!=(const Material& other) const { return !(*this == other); }
 };
 
 #endif
@@ -0,0 +1,50 @@
+/**
+ * @file materialtable.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "materialtable.h"
+
+std::uint32_t MaterialTable::intern(const Material& material)
+{
+	std::uint64_t hash = material.hash();
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto range = by_hash.equal_range(hash);
+	for (auto iter = range.first; iter != range.second; ++iter) {
+		if (materials[iter->second] == material) {
+			return iter->second;
+		}
+	}
+
+	std::uint32_t material_index = materials.size();
+	materials.push_back(material);
+	by_hash.emplace(hash, material_index);
+
+	return material_index;
+}
+
+std::size_t MaterialTable::size() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return materials.size();
+}
+
+Material MaterialTable::get(std::uint32_t index) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return materials.at(index);
+}
+
+std::vector<Material> MaterialTable::snapshot(std::size_t first) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (first >= materials.size()) {
+		return {};
+	}
+	return std::vector<Material>(materials.begin() + first, materials.end());
+}
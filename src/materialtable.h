@@ -0,0 +1,65 @@
+/**
+ * @file materialtable.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_MATERIAL_TABLE_H
+#define CORTEX_MATERIAL_TABLE_H
+
+#include "material.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Contiguous table of interned materials.
+ *
+ * Materials are interned by content, such that equal materials share a
+ * single entry, and meshes refer to their material by table index. A table
+ * may be shared by several entities to deduplicate materials across them.
+ * Entries are only ever appended, so indices remain valid and renderers can
+ * upload the table as one buffer and later upload only the new entries.
+ *
+ * All methods are thread-safe, which allows concurrent loads to intern
+ * materials into the same table.
+ */
+class MaterialTable
+{
+public:
+	MaterialTable() = default;
+
+	MaterialTable(const MaterialTable&) = delete;
+	MaterialTable& operator=(const MaterialTable&) = delete;
+
+	/**
+	 * Intern @p material.
+	 * @return Index of the table entry equal to @p material
+	 */
+	std::uint32_t intern(const Material& material);
+
+	/// Number of table entries
+	std::size_t size() const;
+
+	/// Copy of table entry @p index
+	Material get(std::uint32_t index) const;
+
+	/**
+	 * Copy table entries from @p first onwards, for upload as a single
+	 * buffer.
+	 */
+	std::vector<Material> snapshot(std::size_t first = 0) const;
+
+private:
+	mutable std::mutex mutex;
+	std::vector<Material> materials;
+	std::unordered_multimap<std::uint64_t, std::uint32_t> by_hash;
+};
+
+#endif
@@ -1,13 +1,14 @@
 /**
  * @file mesh.cc
  *
- * Copyright (c) 2013 Leon Lynch
+ * Copyright (c) 2013, 2026 Leon Lynch
  *
  * This file is licensed under the terms of the MIT license.
  * See LICENSE file.
  */
 
 #include "mesh.h"
+#include "vertextransform.h"
 
 Mesh::Mesh(
 	PrimitiveType primitive_type,
@@ -17,8 +18,32 @@ Mesh::Mesh(
 	bool has_bitangents,
 	bool has_colors
 )
+: Mesh(nullptr, primitive_type, vertex_count, has_normals, has_tangents, has_bitangents, has_colors)
+{
+}
+
+Mesh::Mesh(
+	Arena* arena,
+	PrimitiveType primitive_type,
+	std::size_t vertex_count,
+	bool has_normals,
+	bool has_tangents,
+	bool has_bitangents,
+	bool has_colors
+)
 : primitive_type(primitive_type),
-  vertex_size(3)
+  vertex_size(3),
+  vertex_data(ArenaAllocator<float>(arena)),
+  index_data(ArenaAllocator<unsigned int>(arena)),
+  material_index(no_material),
+  meshlets(ArenaAllocator<Meshlet>(arena)),
+  meshlet_vertices(ArenaAllocator<unsigned int>(arena)),
+  meshlet_triangles(ArenaAllocator<unsigned char>(arena)),
+  lods(ArenaAllocator<Lod>(arena)),
+  external_vertices(nullptr),
+  external_vertex_data_size(0),
+  external_indices(nullptr),
+  external_index_data_size(0)
 {
 	normal_size = has_normals ? 3 : 0;
 	tangent_size = has_tangents ? 3 : 0;
@@ -28,3 +53,23 @@ Mesh::Mesh(
 
 	vertex_data.reserve(vertex_count * stride);
 }
+
+void Mesh::setExternalData(
+	const float* vertices,
+	std::size_t vertex_data_size,
+	const unsigned int* indices,
+	std::size_t index_data_size
+)
+{
+	external_vertices = vertices;
+	external_vertex_data_size = vertex_data_size;
+	external_indices = indices;
+	external_index_data_size = index_data_size;
+}
+
+void Mesh::updateBounds()
+{
+	bounds = Bounds();
+	pointBounds(vertexData(), vertexCount(), stride, bounds.min, bounds.max);
+	bounds.updateSphere();
+}
@@ -1,7 +1,7 @@
 /**
  * @file mesh.h
  *
- * Copyright (c) 2013 Leon Lynch
+ * Copyright (c) 2013, 2026 Leon Lynch
  *
  * This file is licensed under the terms of the MIT license.
  * See LICENSE file.
@@ -10,11 +10,12 @@
 #ifndef CORTEX_MESH
 #define CORTEX_MESH
 
-#include <cstddef>
-#include <vector>
+#include "arena.h"
+#include "bounds.h"
+#include "meshlet.h"
 
-// Forward declaration
-class Material;
+#include <cstddef>
+#include <cstdint>
 
 class Mesh
 {
@@ -25,6 +26,16 @@ public:
 		Triangle = 3,
 	};
 
+	/// Material index of meshes without material
+	static constexpr std::uint32_t no_material = 0xFFFFFFFF;
+
+	/// Level of detail; range of index data with its geometric error
+	struct Lod {
+		std::uint32_t index_offset;
+		std::uint32_t index_count;
+		float error; ///< Approximate distance from level 0, in mesh units
+	};
+
 public:
 	// populated by constructor
 	PrimitiveType primitive_type;
@@ -35,10 +46,21 @@ public:
 	std::size_t color_size;
 	std::size_t stride;
 
-	// populated by caller
-	std::vector<float> vertex_data;
-	std::vector<unsigned int> index_data;
-	Material* material;
+	// populated by caller; allocated from the arena given to the
+	// constructor, if any, and therefore sized once
+	ArenaVector<float> vertex_data;
+	ArenaVector<unsigned int> index_data;
+	std::uint32_t material_index; ///< Index into the entity's material table
+	Bounds bounds; ///< Bounds of the vertex positions. See @ref updateBounds().
+
+	// populated by buildMeshlets()
+	ArenaVector<Meshlet> meshlets;
+	ArenaVector<unsigned int> meshlet_vertices;
+	ArenaVector<unsigned char> meshlet_triangles;
+
+	// populated by buildLods(); level 0 is the full detail mesh and the
+	// index data holds the indices of all levels
+	ArenaVector<Lod> lods;
 
 public:
 	/**
@@ -61,8 +83,68 @@ public:
 		bool has_colors = false
 	);
 
+	/**
+	 * Constructor of mesh whose data is allocated from @p arena. The vertex
+	 * data of @p vertex_count vertices is reserved in the arena up front,
+	 * such that it can be written in place.
+	 * @param arena Arena, or nullptr to allocate from the heap
+	 * @see Mesh::Mesh
+	 */
+	Mesh(
+		Arena* arena,
+		PrimitiveType primitive_type,
+		std::size_t vertex_count,
+		bool has_normals = false,
+		bool has_tangents = false,
+		bool has_bitangents = false,
+		bool has_colors = false
+	);
+
 	Mesh(const Mesh&) = delete;
 	Mesh& operator=(const Mesh&) = delete;
+
+	/**
+	 * Refer to external vertex and index data instead of @ref vertex_data
+	 * and @ref index_data, without copying. The caller must ensure that
+	 * the external data outlives the mesh.
+	 * @param vertices External vertex data
+	 * @param vertex_data_size Number of floats in @p vertices
+	 * @param indices External index data
+	 * @param index_data_size Number of indices in @p indices
+	 */
+	void setExternalData(
+		const float* vertices,
+		std::size_t vertex_data_size,
+		const unsigned int* indices,
+		std::size_t index_data_size
+	);
+
+	/**
+	 * Compute @ref bounds by scanning the vertex positions. Scene loaders
+	 * compute the bounds while writing vertex data instead.
+	 */
+	void updateBounds();
+
+	/// Vertex data; either @ref vertex_data or external data
+	const float* vertexData() const { return external_vertices ? external_vertices : vertex_data.data(); }
+
+	/// Number of floats in vertex data
+	std::size_t vertexDataSize() const { return external_vertices ? external_vertex_data_size : vertex_data.size(); }
+
+	/// Index data; either @ref index_data or external data
+	const unsigned int* indexData() const { return external_indices ? external_indices : index_data.data(); }
+
+	/// Number of indices in index data
+	std::size_t indexDataSize() const { return external_indices ? external_index_data_size : index_data.size(); }
+
+	/// Number of vertices
+	std::size_t vertexCount() const { return vertexDataSize() / stride; }
+
+private:
+	const float* external_vertices;
+	std::size_t external_vertex_data_size;
+	const unsigned int* external_indices;
+	std::size_t external_index_data_size;
 };
 
 #endif
@@ -0,0 +1,266 @@
+/**
+ * @file meshlet.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "meshlet.h"
+#include "mesh.h"
+
+#include <algorithm>
+#include <cmath>
+
+static constexpr unsigned int invalid_index = ~0u;
+
+static float dot(const float a[3], const float b[3])
+{
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static float distanceSquared(const float a[3], const float b[3])
+{
+	float d[3] = { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+	return dot(d, d);
+}
+
+/**
+ * Ritter's bounding sphere: start with the sphere spanning an approximately
+ * most distant pair of points, then grow it to enclose any outliers.
+ */
+static void computeBoundingSphere(const float* positions, std::size_t stride, const unsigned int* vertices, std::size_t count, Meshlet& meshlet)
+{
+	auto point = [&](std::size_t i) { return positions + vertices[i] * stride; };
+
+	const float* a = point(0);
+	const float* b = a;
+	for (std::size_t i = 1; i < count; ++i) {
+		if (distanceSquared(point(i), a) > distanceSquared(b, a)) {
+			b = point(i);
+		}
+	}
+	a = b;
+	for (std::size_t i = 0; i < count; ++i) {
+		if (distanceSquared(point(i), b) > distanceSquared(a, b)) {
+			a = point(i);
+		}
+	}
+
+	float center[3] = { (a[0] + b[0]) * 0.5f, (a[1] + b[1]) * 0.5f, (a[2] + b[2]) * 0.5f };
+	float radius = std::sqrt(distanceSquared(a, b)) * 0.5f;
+
+	for (std::size_t i = 0; i < count; ++i) {
+		const float* p = point(i);
+		float d = std::sqrt(distanceSquared(p, center));
+		if (d > radius) {
+			// Move the center towards the outlier such that the new sphere
+			// touches both the outlier and the far side of the old sphere
+			float shift = (d - radius) * 0.5f / d;
+			for (std::size_t c = 0; c < 3; ++c) {
+				center[c] += (p[c] - center[c]) * shift;
+			}
+			radius = (radius + d) * 0.5f;
+		}
+	}
+
+	std::copy_n(center, 3, meshlet.center);
+	meshlet.radius = radius;
+}
+
+static void computeNormalCone(
+	const float* positions,
+	std::size_t stride,
+	const unsigned int* vertices,
+	const unsigned char* triangles,
+	std::size_t triangle_count,
+	Meshlet& meshlet
+)
+{
+	// Below this cosine of the spread angle, the cone is too wide to cull
+	static constexpr float min_spread_cosine = 0.1f;
+
+	std::vector<float> normals;
+	float axis[3] = { 0.0f, 0.0f, 0.0f };
+
+	normals.reserve(triangle_count * 3);
+	for (std::size_t t = 0; t < triangle_count; ++t) {
+		const float* p0 = positions + vertices[triangles[t * 3 + 0]] * stride;
+		const float* p1 = positions + vertices[triangles[t * 3 + 1]] * stride;
+		const float* p2 = positions + vertices[triangles[t * 3 + 2]] * stride;
+		float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+		float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+		float n[3] = {
+			e1[1] * e2[2] - e1[2] * e2[1],
+			e1[2] * e2[0] - e1[0] * e2[2],
+			e1[0] * e2[1] - e1[1] * e2[0],
+		};
+		float length = std::sqrt(dot(n, n));
+
+		// Degenerate triangles have no orientation to cull by
+		if (length == 0.0f) {
+			continue;
+		}
+		for (std::size_t c = 0; c < 3; ++c) {
+			n[c] /= length;
+			axis[c] += n[c];
+		}
+		normals.insert(normals.end(), n, n + 3);
+	}
+
+	std::fill_n(meshlet.cone_apex, 3, 0.0f);
+	std::fill_n(meshlet.cone_axis, 3, 0.0f);
+	meshlet.cone_cutoff = 1.0f;
+
+	float axis_length = std::sqrt(dot(axis, axis));
+	if (normals.empty() || axis_length == 0.0f) {
+		return;
+	}
+	for (std::size_t c = 0; c < 3; ++c) {
+		axis[c] /= axis_length;
+	}
+
+	float min_dot = 1.0f;
+	for (std::size_t i = 0; i < normals.size(); i += 3) {
+		min_dot = std::min(min_dot, dot(axis, &normals[i]));
+	}
+	if (min_dot <= min_spread_cosine) {
+		return;
+	}
+
+	// Place the apex behind the center far enough that every triangle
+	// plane separates the apex from the visible side
+	float max_t = 0.0f;
+	for (std::size_t t = 0, n = 0; t < triangle_count; ++t) {
+		const float* p0 = positions + vertices[triangles[t * 3 + 0]] * stride;
+		const float* p1 = positions + vertices[triangles[t * 3 + 1]] * stride;
+		const float* p2 = positions + vertices[triangles[t * 3 + 2]] * stride;
+		float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+		float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+		float cross[3] = {
+			e1[1] * e2[2] - e1[2] * e2[1],
+			e1[2] * e2[0] - e1[0] * e2[2],
+			e1[0] * e2[1] - e1[1] * e2[0],
+		};
+		if (dot(cross, cross) == 0.0f) {
+			continue;
+		}
+
+		const float* normal = &normals[n];
+		n += 3;
+		float offset[3] = { meshlet.center[0] - p0[0], meshlet.center[1] - p0[1], meshlet.center[2] - p0[2] };
+		float t_plane = dot(offset, normal) / dot(axis, normal);
+		max_t = std::max(max_t, t_plane);
+	}
+
+	for (std::size_t c = 0; c < 3; ++c) {
+		meshlet.cone_apex[c] = meshlet.center[c] - axis[c] * max_t;
+		meshlet.cone_axis[c] = axis[c];
+	}
+	meshlet.cone_cutoff = std::sqrt(1.0f - min_dot * min_dot);
+}
+
+std::size_t buildMeshlets(
+	std::vector<Meshlet>& meshlets,
+	std::vector<unsigned int>& meshlet_vertices,
+	std::vector<unsigned char>& meshlet_triangles,
+	const unsigned int* indices,
+	std::size_t index_count,
+	const float* positions,
+	std::size_t vertex_count,
+	std::size_t stride,
+	std::size_t max_vertices,
+	std::size_t max_triangles
+)
+{
+	std::size_t first_meshlet = meshlets.size();
+	std::vector<unsigned int> local(vertex_count, invalid_index);
+	Meshlet meshlet{};
+
+	max_vertices = std::min(std::max<std::size_t>(max_vertices, 3), max_meshlet_vertices);
+	max_triangles = std::min(std::max<std::size_t>(max_triangles, 1), max_meshlet_triangles);
+
+	auto finish = [&]() {
+		const unsigned int* vertices = &meshlet_vertices[meshlet.vertex_offset];
+		const unsigned char* triangles = &meshlet_triangles[meshlet.triangle_offset];
+
+		computeBoundingSphere(positions, stride, vertices, meshlet.vertex_count, meshlet);
+		computeNormalCone(positions, stride, vertices, triangles, meshlet.triangle_count, meshlet);
+		meshlets.push_back(meshlet);
+
+		for (std::size_t i = 0; i < meshlet.vertex_count; ++i) {
+			local[vertices[i]] = invalid_index;
+		}
+		meshlet = Meshlet{};
+		meshlet.vertex_offset = meshlet_vertices.size();
+		meshlet.triangle_offset = meshlet_triangles.size();
+	};
+
+	meshlet.vertex_offset = meshlet_vertices.size();
+	meshlet.triangle_offset = meshlet_triangles.size();
+
+	for (std::size_t i = 0; i + 2 < index_count; i += 3) {
+		const unsigned int* triangle = indices + i;
+		std::size_t new_vertices =
+			(local[triangle[0]] == invalid_index) +
+			(local[triangle[1]] == invalid_index && triangle[1] != triangle[0]) +
+			(local[triangle[2]] == invalid_index && triangle[2] != triangle[0] && triangle[2] != triangle[1]);
+
+		if (meshlet.vertex_count + new_vertices > max_vertices ||
+			meshlet.triangle_count + 1 > max_triangles
+		) {
+			finish();
+		}
+
+		for (std::size_t c = 0; c < 3; ++c) {
+			unsigned int& v = local[triangle[c]];
+			if (v == invalid_index) {
+				v = meshlet.vertex_count++;
+				meshlet_vertices.push_back(triangle[c]);
+			}
+			meshlet_triangles.push_back(static_cast<unsigned char>(v));
+		}
+		++meshlet.triangle_count;
+	}
+
+	if (meshlet.triangle_count) {
+		finish();
+	}
+
+	return meshlets.size() - first_meshlet;
+}
+
+bool buildMeshlets(Mesh* mesh)
+{
+	std::vector<Meshlet> meshlets;
+	std::vector<unsigned int> meshlet_vertices;
+	std::vector<unsigned char> meshlet_triangles;
+
+	mesh->meshlets.clear();
+	mesh->meshlet_vertices.clear();
+	mesh->meshlet_triangles.clear();
+
+	if (mesh->primitive_type != Mesh::PrimitiveType::Triangle) {
+		return false;
+	}
+
+	// Meshlets cover level 0 only. They are built in scratch space and
+	// copied, such that the mesh's storage is allocated once at its final
+	// size.
+	buildMeshlets(
+		meshlets,
+		meshlet_vertices,
+		meshlet_triangles,
+		mesh->indexData(),
+		mesh->lods.empty() ? mesh->indexDataSize() : mesh->lods.front().index_count,
+		mesh->vertexData(),
+		mesh->vertexCount(),
+		mesh->stride
+	);
+	mesh->meshlets.assign(meshlets.begin(), meshlets.end());
+	mesh->meshlet_vertices.assign(meshlet_vertices.begin(), meshlet_vertices.end());
+	mesh->meshlet_triangles.assign(meshlet_triangles.begin(), meshlet_triangles.end());
+
+	return true;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file meshlet.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_MESHLET_H
+#define CORTEX_MESHLET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Forward declaration
+class Mesh;
+
+/// Maximum number of vertices per meshlet
+constexpr std::size_t max_meshlet_vertices = 64;
+
+/// Maximum number of triangles per meshlet
+constexpr std::size_t max_meshlet_triangles = 124;
+
+/**
+ * @brief Cluster of triangles with bounds for cluster culling.
+ *
+ * The vertices of a meshlet are stored in a vertex list that refers to the
+ * vertices of the mesh, and its triangles are stored as three byte-sized
+ * indices into that vertex list each.
+ *
+ * The bounding sphere allows frustum culling of the meshlet. The normal
+ * cone, which contains the normals of all triangles of the meshlet, allows
+ * backface culling of the whole meshlet:
+ * @code
+ * // Cull if all triangles face away from the camera
+ * dot(normalize(cone_apex - camera_position), cone_axis) >= cone_cutoff
+ * // Or, using the bounding sphere instead of the apex
+ * dot(center - camera_position, cone_axis) >= cone_cutoff * length(center - camera_position) + radius
+ * @endcode
+ * Meshlets with triangles facing in widely different directions have a
+ * zero cone axis and a cutoff of 1, such that they are never culled.
+ */
+struct Meshlet
+{
+	std::uint32_t vertex_offset; ///< First entry in the meshlet vertex list
+	std::uint32_t triangle_offset; ///< First byte in the meshlet triangle list
+	std::uint32_t vertex_count;
+	std::uint32_t triangle_count;
+
+	float center[3]; ///< Bounding sphere center
+	float radius; ///< Bounding sphere radius
+
+	float cone_apex[3]; ///< Normal cone apex
+	float cone_axis[3]; ///< Normal cone axis; unit length or zero
+	float cone_cutoff; ///< Sine of the normal cone spread angle
+};
+
+/**
+ * @brief Split triangle list into meshlets and compute their bounds.
+ *
+ * Triangles are assigned to meshlets in order, starting a new meshlet when
+ * either limit would be exceeded. Triangle lists optimized for the vertex
+ * cache, for example using @ref optimizeVertexCache, have the locality
+ * required for compact meshlets.
+ *
+ * @param meshlets Meshlets output. New meshlets are appended.
+ * @param meshlet_vertices Meshlet vertex list output. New entries are
+ *                         appended.
+ * @param meshlet_triangles Meshlet triangle list output. New entries are
+ *                          appended.
+ * @param indices Triangle list
+ * @param index_count Number of indices. Trailing partial triangles are
+ *                    ignored.
+ * @param positions Vertex positions; the x,y,z floats of vertex @p i are at
+ *                  @p positions + @p i * @p stride
+ * @param vertex_count Number of vertices
+ * @param stride Position stride in floats. Must be >= 3.
+ * @param max_vertices Maximum number of vertices per meshlet; at most
+ *                     @ref max_meshlet_vertices
+ * @param max_triangles Maximum number of triangles per meshlet; at most
+ *                      @ref max_meshlet_triangles
+ * @return Number of meshlets appended
+ */
+std::size_t buildMeshlets(
+	std::vector<Meshlet>& meshlets,
+	std::vector<unsigned int>& meshlet_vertices,
+	std::vector<unsigned char>& meshlet_triangles,
+	const unsigned int* indices,
+	std::size_t index_count,
+	const float* positions,
+	std::size_t vertex_count,
+	std::size_t stride,
+	std::size_t max_vertices = max_meshlet_vertices,
+	std::size_t max_triangles = max_meshlet_triangles
+);
+
+/**
+ * @brief Replace the meshlets of triangle mesh @p mesh.
+ *
+ * @return Boolean indicating whether meshlets were built. Meshes that are
+ *         not triangle meshes have no meshlets.
+ */
+bool buildMeshlets(Mesh* mesh);
+
+#endif
@@ -0,0 +1,189 @@
+/**
+ * @file packed.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_PACKED_H
+#define CORTEX_PACKED_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "vertex_traits.h"
+
+/**
+ * @brief Unit vector encoded as two normalized signed 16-bit integers using
+ *        an octahedral mapping.
+ *
+ * The unit sphere is projected onto the octahedron |x| + |y| + |z| = 1 and the
+ * lower hemisphere is folded over the upper hemisphere, such that the vector
+ * can be stored as two components in the range [-1, 1]. The input need not be
+ * normalized. The maximum angular error is about 0.005 degrees.
+ *
+ * Decode in GLSL using a @c vec2 attribute:
+ * @code
+ * vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+ * float t = max(-n.z, 0.0);
+ * n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+ * n = normalize(n);
+ * @endcode
+ */
+struct OctahedralNormal
+{
+	static constexpr detail::component_type packed_type = detail::component_type::Short;
+	static constexpr std::size_t packed_size = 2;
+	static constexpr bool packed_normalized = true;
+
+	std::int16_t x;
+	std::int16_t y;
+
+	OctahedralNormal() = default;
+	OctahedralNormal(float nx, float ny, float nz);
+
+	template<typename V, typename = decltype(std::declval<const V&>().z)>
+	OctahedralNormal(const V& n) : OctahedralNormal(n.x, n.y, n.z) {}
+
+	/**
+	 * @brief Decode to normalized vector type @p V.
+	 */
+	template<typename V>
+	V unpack() const;
+};
+
+/**
+ * @brief Unit vector and handedness encoded as normalized signed
+ *        2_10_10_10_REV integer components.
+ *
+ * Matches @c GL_INT_2_10_10_10_REV with normalization enabled. The x, y and z
+ * components use 10 bits each and the w component holds the handedness of
+ * the tangent frame (+1 or -1). The input vector is normalized before
+ * encoding.
+ *
+ * The handedness defaults to +1, which matches tangent frames where the
+ * bitangent is cross(normal, tangent), as produced by the tessellators in
+ * this library. Shaders can therefore omit the bitangent attribute and
+ * reconstruct it as @c cross(n, t.xyz) @c * @c t.w.
+ */
+struct PackedTangent
+{
+	static constexpr detail::component_type packed_type = detail::component_type::Int_2_10_10_10_Rev;
+	static constexpr std::size_t packed_size = 4;
+	static constexpr bool packed_normalized = true;
+
+	std::uint32_t value;
+
+	PackedTangent() = default;
+	PackedTangent(float tx, float ty, float tz, float handedness = 1.0f);
+
+	template<typename V, typename = decltype(std::declval<const V&>().z)>
+	PackedTangent(const V& t) : PackedTangent(t.x, t.y, t.z, 1.0f) {}
+
+	/**
+	 * @brief Handedness of the tangent frame (+1 or -1).
+	 */
+	float handedness() const;
+
+	/**
+	 * @brief Decode tangent direction to vector type @p V.
+	 */
+	template<typename V>
+	V unpack() const;
+};
+
+/**
+ * @brief Two component vector stored as IEEE 754 half-precision floats.
+ *
+ * Intended for texture coordinates. Values in [0, 1] retain at least 11 bits
+ * of precision, which is sufficient for textures of up to 2048 texels per
+ * dimension. No shader decoding is required for a @c vec2 attribute.
+ */
+struct HalfTexcoord
+{
+	static constexpr detail::component_type packed_type = detail::component_type::HalfFloat;
+	static constexpr std::size_t packed_size = 2;
+	static constexpr bool packed_normalized = false;
+
+	/// Type accepted by the converting constructor
+	using value_type = float;
+
+	std::uint16_t s;
+	std::uint16_t t;
+
+	HalfTexcoord() = default;
+	HalfTexcoord(float u, float v);
+
+	template<typename V, typename = decltype(std::declval<const V&>().y)>
+	HalfTexcoord(const V& st) : HalfTexcoord(st.x, st.y) {}
+
+	/**
+	 * @brief Decode to vector type @p V.
+	 */
+	template<typename V>
+	V unpack() const;
+};
+
+/**
+ * @brief Position stored as normalized unsigned 16-bit integers relative to a
+ *        bounding box.
+ *
+ * The constructor expects coordinates already mapped to [0, 1], typically
+ * (p - aabb_min) / (aabb_max - aabb_min). Shaders reconstruct the position as
+ * @c bias @c + @c scale @c * @c v_position with @c bias = aabb_min and
+ * @c scale = aabb_max - aabb_min. The maximum error per axis is half a step,
+ * i.e. extent / 131070.
+ */
+struct QuantizedPosition
+{
+	static constexpr detail::component_type packed_type = detail::component_type::UnsignedShort;
+	static constexpr std::size_t packed_size = 3;
+	static constexpr bool packed_normalized = true;
+
+	std::uint16_t x;
+	std::uint16_t y;
+	std::uint16_t z;
+
+	QuantizedPosition() = default;
+	QuantizedPosition(float qx, float qy, float qz);
+
+	template<typename V, typename = decltype(std::declval<const V&>().z)>
+	QuantizedPosition(const V& q) : QuantizedPosition(q.x, q.y, q.z) {}
+
+	/**
+	 * @brief Decode to vector type @p V with components in [0, 1].
+	 */
+	template<typename V>
+	V unpack() const;
+};
+
+namespace detail {
+
+/**
+ * @brief Convert single-precision float to half-precision float bits using
+ *        round-to-nearest-even.
+ */
+std::uint16_t float_to_half(float f);
+
+/**
+ * @brief Convert half-precision float bits to single-precision float.
+ */
+float half_to_float(std::uint16_t h);
+
+/**
+ * @brief Decode vertex member @p m to full precision vector type @p V.
+ *
+ * Packed members are unpacked and full precision members are converted.
+ */
+template<typename V, typename M>
+V unpack(const M& m);
+
+} // namespace detail
+
+#include "packed.tcc"
+
+#endif
@@ -0,0 +1,244 @@
+/**
+ * @file packed.tcc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "packed.h"
+
+#ifndef CORTEX_PACKED_TCC
+#define CORTEX_PACKED_TCC
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace detail {
+
+inline std::int16_t pack_snorm16(float v)
+{
+	return static_cast<std::int16_t>(std::round(std::clamp(v, -1.0f, 1.0f) * 32767.0f));
+}
+
+inline float unpack_snorm16(std::int16_t v)
+{
+	return std::max(v / 32767.0f, -1.0f);
+}
+
+inline std::uint32_t pack_snorm10(float v)
+{
+	return static_cast<std::uint32_t>(static_cast<std::int32_t>(std::round(std::clamp(v, -1.0f, 1.0f) * 511.0f))) & 0x3FF;
+}
+
+inline float unpack_snorm10(std::uint32_t v)
+{
+	// Sign extend 10-bit value
+	std::int32_t i = static_cast<std::int32_t>(v << 22) >> 22;
+	return std::max(i / 511.0f, -1.0f);
+}
+
+inline std::uint16_t pack_unorm16(float v)
+{
+	return static_cast<std::uint16_t>(std::round(std::clamp(v, 0.0f, 1.0f) * 65535.0f));
+}
+
+inline float unpack_unorm16(std::uint16_t v)
+{
+	return v / 65535.0f;
+}
+
+inline float sign_not_zero(float v)
+{
+	return v >= 0.0f ? 1.0f : -1.0f;
+}
+
+inline std::uint16_t float_to_half(float f)
+{
+	std::uint32_t bits;
+	std::memcpy(&bits, &f, sizeof(bits));
+
+	std::uint32_t sign = (bits >> 16) & 0x8000;
+	std::uint32_t exponent = (bits >> 23) & 0xFF;
+	std::uint32_t mantissa = bits & 0x7FFFFF;
+
+	if (exponent == 0xFF) {
+		// Infinity or NaN
+		return sign | 0x7C00 | (mantissa ? 0x200 : 0);
+	}
+
+	int e = static_cast<int>(exponent) - 127 + 15;
+	if (e >= 0x1F) {
+		// Overflow to infinity
+		return sign | 0x7C00;
+	}
+
+	if (e <= 0) {
+		if (e < -10) {
+			// Underflow to zero
+			return sign;
+		}
+
+		// Subnormal half
+		mantissa |= 0x800000;
+		unsigned int shift = 14 - e;
+		std::uint32_t half_mantissa = mantissa >> shift;
+		std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+		std::uint32_t halfway = 1u << (shift - 1);
+		if (remainder > halfway || (remainder == halfway && (half_mantissa & 1))) {
+			++half_mantissa;
+		}
+		return sign | half_mantissa;
+	}
+
+	std::uint32_t half = sign | (static_cast<std::uint32_t>(e) << 10) | (mantissa >> 13);
+	std::uint32_t remainder = mantissa & 0x1FFF;
+	if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) {
+		// Carry may propagate into the exponent, which yields the correct
+		// result including overflow to infinity
+		++half;
+	}
+	return static_cast<std::uint16_t>(half);
+}
+
+inline float half_to_float(std::uint16_t h)
+{
+	std::uint32_t sign = static_cast<std::uint32_t>(h & 0x8000) << 16;
+	std::uint32_t exponent = (h >> 10) & 0x1F;
+	std::uint32_t mantissa = h & 0x3FF;
+	std::uint32_t bits;
+
+	if (exponent == 0x1F) {
+		bits = sign | 0x7F800000 | (mantissa << 13);
+	} else if (exponent) {
+		bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+	} else if (mantissa) {
+		// Normalize subnormal half
+		int e = -1;
+		do {
+			++e;
+			mantissa <<= 1;
+		} while (!(mantissa & 0x400));
+		bits = sign | (static_cast<std::uint32_t>(127 - 15 - e) << 23) | ((mantissa & 0x3FF) << 13);
+	} else {
+		bits = sign;
+	}
+
+	float f;
+	std::memcpy(&f, &bits, sizeof(f));
+	return f;
+}
+
+template<typename V, typename M>
+V unpack(const M& m)
+{
+	if constexpr (is_packed<M>::value)
+		return m.template unpack<V>();
+	else
+		return V(m);
+}
+
+} // namespace detail
+
+inline OctahedralNormal::OctahedralNormal(float nx, float ny, float nz)
+{
+	// Project onto octahedron
+	float l1 = std::abs(nx) + std::abs(ny) + std::abs(nz);
+	if (l1 == 0.0f) {
+		x = 0;
+		y = 0;
+		return;
+	}
+	float px = nx / l1;
+	float py = ny / l1;
+
+	// Fold lower hemisphere over upper hemisphere
+	if (nz < 0.0f) {
+		float fx = (1.0f - std::abs(py)) * detail::sign_not_zero(px);
+		float fy = (1.0f - std::abs(px)) * detail::sign_not_zero(py);
+		px = fx;
+		py = fy;
+	}
+
+	x = detail::pack_snorm16(px);
+	y = detail::pack_snorm16(py);
+}
+
+template<typename V>
+V OctahedralNormal::unpack() const
+{
+	float ex = detail::unpack_snorm16(x);
+	float ey = detail::unpack_snorm16(y);
+	float nx = ex;
+	float ny = ey;
+	float nz = 1.0f - std::abs(ex) - std::abs(ey);
+
+	// Unfold lower hemisphere
+	float t = std::max(-nz, 0.0f);
+	nx += nx >= 0.0f ? -t : t;
+	ny += ny >= 0.0f ? -t : t;
+
+	float length = std::sqrt(nx * nx + ny * ny + nz * nz);
+	return V(nx / length, ny / length, nz / length);
+}
+
+inline PackedTangent::PackedTangent(float tx, float ty, float tz, float handedness)
+{
+	float length = std::sqrt(tx * tx + ty * ty + tz * tz);
+	if (length > 0.0f) {
+		tx /= length;
+		ty /= length;
+		tz /= length;
+	}
+
+	value =
+		detail::pack_snorm10(tx) |
+		(detail::pack_snorm10(ty) << 10) |
+		(detail::pack_snorm10(tz) << 20) |
+		((handedness < 0.0f ? 0x3u : 0x1u) << 30);
+}
+
+inline float PackedTangent::handedness() const
+{
+	// 2-bit signed value; -1 is 0b11 and +1 is 0b01
+	return (value >> 31) ? -1.0f : 1.0f;
+}
+
+template<typename V>
+V PackedTangent::unpack() const
+{
+	return V(
+		detail::unpack_snorm10(value & 0x3FF),
+		detail::unpack_snorm10((value >> 10) & 0x3FF),
+		detail::unpack_snorm10((value >> 20) & 0x3FF)
+	);
+}
+
+inline QuantizedPosition::QuantizedPosition(float qx, float qy, float qz)
+: x(detail::pack_unorm16(qx)),
+  y(detail::pack_unorm16(qy)),
+  z(detail::pack_unorm16(qz))
+{
+}
+
+template<typename V>
+V QuantizedPosition::unpack() const
+{
+	return V(detail::unpack_unorm16(x), detail::unpack_unorm16(y), detail::unpack_unorm16(z));
+}
+
+inline HalfTexcoord::HalfTexcoord(float u, float v)
+: s(detail::float_to_half(u)),
+  t(detail::float_to_half(v))
+{
+}
+
+template<typename V>
+V HalfTexcoord::unpack() const
+{
+	return V(detail::half_to_float(s), detail::half_to_float(t));
+}
+
+#endif
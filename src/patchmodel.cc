@@ -0,0 +1,337 @@
+/**
+ * @file patchmodel.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "patchmodel.h"
+#include "mappedfile.h"
+#include "threadpool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <thread>
+
+static_assert(sizeof(Teaset::ControlPoint) == 3 * sizeof(float), "ControlPoint must match the binary layout");
+
+// Number of patches or control points parsed per parallel chunk
+static constexpr std::size_t chunk_size = 16384;
+
+static const char binary_magic[4] = { 'B', 'P', 'C', 'H' };
+
+// PatchModelStorage is constructed first, because it is the first base
+PatchModel::PatchModel()
+: Teaset(PatchModelStorage::data)
+{
+}
+
+PatchModel::~PatchModel()
+{
+}
+
+/**
+ * Parse every chunk index in [0, @p chunk_count) using a @ref ThreadPool
+ * with at most one thread per chunk. Remaining chunks are skipped once
+ * @p func returns false.
+ */
+template<typename Func>
+static bool parseChunks(std::size_t chunk_count, Func func)
+{
+	std::atomic<bool> success(true);
+	ThreadPool pool(std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(), chunk_count)));
+
+	pool.parallelFor(chunk_count, [&](std::size_t chunk) {
+		if (success && !func(chunk)) {
+			success = false;
+		}
+	});
+
+	return success;
+}
+
+static bool hostIsLittleEndian()
+{
+	const std::uint32_t value = 1;
+	unsigned char first;
+	std::memcpy(&first, &value, 1);
+	return first == 1;
+}
+
+// Convert a little-endian value of the binary layout to host order
+static std::uint32_t fromLittleEndian(std::uint32_t value)
+{
+	if (hostIsLittleEndian()) {
+		return value;
+	}
+	return (value >> 24) | ((value >> 8) & 0xFF00) | ((value << 8) & 0xFF0000) | (value << 24);
+}
+
+static std::size_t patchColumn(std::size_t i, bool data_is_ccw)
+{
+	return data_is_ccw ? i % 4 : 3 - (i % 4);
+}
+
+static bool isBlank(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static const char* nextLine(const char* p, const char* end)
+{
+	const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+	return newline ? newline + 1 : end;
+}
+
+/**
+ * Skip whitespace, including blank lines and carriage returns, up to the
+ * start of the next record. Used both to split sections into lines and to
+ * parse them, such that both see the same lines.
+ */
+static const char* skipBlankLines(const char* p, const char* end)
+{
+	while (p < end && isBlank(*p)) {
+		++p;
+	}
+	return p;
+}
+
+/**
+ * Parse the next number on the current line. Numbers are separated by
+ * commas or whitespace, but never by line breaks.
+ */
+template<typename T>
+static bool parseNumber(const char*& p, const char* end, T& value)
+{
+	while (p < end && (*p == ',' || *p == ' ' || *p == '\t')) {
+		++p;
+	}
+
+	auto [ptr, ec] = std::from_chars(p, end, value);
+	if (ec != std::errc()) {
+		return false;
+	}
+	p = ptr;
+
+	return true;
+}
+
+/**
+ * Locate the next @p line_count non-blank lines starting at @p p and record
+ * the start of every chunk of @ref chunk_size lines in @p chunks.
+ * @return End of the last line, or nullptr if there are too few lines
+ */
+static const char* splitLines(const char* p, const char* end, std::size_t line_count, std::vector<const char*>& chunks)
+{
+	chunks.clear();
+	chunks.reserve((line_count + chunk_size - 1) / chunk_size);
+	for (std::size_t i = 0; i < line_count; ++i) {
+		p = skipBlankLines(p, end);
+		if (p == end) {
+			return nullptr;
+		}
+
+		if (i % chunk_size == 0) {
+			chunks.push_back(p);
+		}
+		p = nextLine(p, end);
+	}
+
+	return p;
+}
+
+static bool parseCount(const char*& p, const char* end, std::size_t& count)
+{
+	p = skipBlankLines(p, end);
+	if (!parseNumber(p, end, count)) {
+		return false;
+	}
+	p = nextLine(p, end);
+
+	return true;
+}
+
+bool PatchModel::parseText(const char* data, std::size_t size, bool data_is_ccw)
+{
+	const char* p = data;
+	const char* end = data + size;
+	std::size_t patch_count;
+	std::size_t control_point_count;
+	std::vector<const char*> patch_chunks;
+	std::vector<const char*> control_point_chunks;
+
+	// Locate sections sequentially; this only searches for line breaks
+	if (!parseCount(p, end, patch_count)) {
+		return false;
+	}
+	p = splitLines(p, end, patch_count, patch_chunks);
+	if (!p) {
+		return false;
+	}
+	if (!parseCount(p, end, control_point_count)) {
+		return false;
+	}
+	if (!splitLines(p, end, control_point_count, control_point_chunks)) {
+		return false;
+	}
+
+	patch_data.resize(patch_count);
+	control_points.resize(control_point_count);
+
+	// Parse both sections in parallel chunks
+	return parseChunks(patch_chunks.size() + control_point_chunks.size(), [&](std::size_t chunk) {
+		if (chunk < patch_chunks.size()) {
+			const char* p = patch_chunks[chunk];
+			std::size_t first = chunk * chunk_size;
+			std::size_t last = std::min(first + chunk_size, patch_count);
+
+			for (std::size_t i = first; i < last; ++i) {
+				p = skipBlankLines(p, end);
+				for (std::size_t j = 0; j < 16; ++j) {
+					std::uint32_t index;
+					if (!parseNumber(p, end, index) || index < 1 || index > control_point_count) {
+						return false;
+					}
+					patch_data[i].k[j / 4][patchColumn(j, data_is_ccw)] = index - 1;
+				}
+				p = nextLine(p, end);
+			}
+		} else {
+			chunk -= patch_chunks.size();
+			const char* p = control_point_chunks[chunk];
+			std::size_t first = chunk * chunk_size;
+			std::size_t last = std::min(first + chunk_size, control_point_count);
+
+			for (std::size_t i = first; i < last; ++i) {
+				ControlPoint& k = control_points[i];
+				p = skipBlankLines(p, end);
+				if (!parseNumber(p, end, k.x) ||
+					!parseNumber(p, end, k.y) ||
+					!parseNumber(p, end, k.z)
+				) {
+					return false;
+				}
+				p = nextLine(p, end);
+			}
+		}
+
+		return true;
+	});
+}
+
+bool PatchModel::parseBinary(const char* data, std::size_t size, bool data_is_ccw)
+{
+	BinaryHeader header;
+
+	if (size < sizeof(header)) {
+		return false;
+	}
+	std::memcpy(&header, data, sizeof(header));
+	header.version = fromLittleEndian(header.version);
+	header.patch_count = fromLittleEndian(header.patch_count);
+	header.control_point_count = fromLittleEndian(header.control_point_count);
+	if (std::memcmp(header.magic, binary_magic, sizeof(binary_magic)) != 0 ||
+		header.version != 1
+	) {
+		return false;
+	}
+
+	std::size_t patch_count = header.patch_count;
+	std::size_t control_point_count = header.control_point_count;
+	std::size_t index_size = patch_count * 16 * sizeof(std::uint32_t);
+	std::size_t control_point_size = control_point_count * sizeof(ControlPoint);
+	if (size != sizeof(header) + index_size + control_point_size) {
+		return false;
+	}
+	const char* index_data = data + sizeof(header);
+	const char* control_point_data = index_data + index_size;
+
+	patch_data.resize(patch_count);
+	control_points.resize(control_point_count);
+
+	std::size_t patch_chunk_count = (patch_count + chunk_size - 1) / chunk_size;
+	std::size_t control_point_chunk_count = (control_point_count + chunk_size - 1) / chunk_size;
+	return parseChunks(patch_chunk_count + control_point_chunk_count, [&](std::size_t chunk) {
+		if (chunk < patch_chunk_count) {
+			std::size_t first = chunk * chunk_size;
+			std::size_t last = std::min(first + chunk_size, patch_count);
+
+			for (std::size_t i = first; i < last; ++i) {
+				std::uint32_t indices[16];
+				std::memcpy(indices, index_data + i * sizeof(indices), sizeof(indices));
+				for (std::size_t j = 0; j < 16; ++j) {
+					std::uint32_t index = fromLittleEndian(indices[j]);
+					if (index >= control_point_count) {
+						return false;
+					}
+					patch_data[i].k[j / 4][patchColumn(j, data_is_ccw)] = index;
+				}
+			}
+		} else {
+			std::size_t first = (chunk - patch_chunk_count) * chunk_size;
+			std::size_t count = std::min(chunk_size, control_point_count - first);
+
+			std::memcpy(
+				control_points.data() + first,
+				control_point_data + first * sizeof(ControlPoint),
+				count * sizeof(ControlPoint)
+			);
+
+			// Coordinates are swapped through their bit patterns
+			if (!hostIsLittleEndian()) {
+				for (std::size_t i = first; i < first + count; ++i) {
+					for (float* c : { &control_points[i].x, &control_points[i].y, &control_points[i].z }) {
+						std::uint32_t bits;
+						std::memcpy(&bits, c, sizeof(bits));
+						bits = fromLittleEndian(bits);
+						std::memcpy(c, &bits, sizeof(bits));
+					}
+				}
+			}
+		}
+
+		return true;
+	});
+}
+
+void PatchModel::updateGeometry()
+{
+	data.control_points = control_points.data();
+	data.control_point_count = control_points.size();
+	data.patches = patch_data.data();
+	data.patch_count = patch_data.size();
+}
+
+bool PatchModel::load(const std::string& filename, bool data_is_ccw)
+{
+	MappedFile file;
+	bool ret = false;
+
+	control_points.clear();
+	patch_data.clear();
+
+	if (file.open(filename)) {
+		if (file.size() >= sizeof(binary_magic) &&
+			std::memcmp(file.data(), binary_magic, sizeof(binary_magic)) == 0
+		) {
+			ret = parseBinary(file.data(), file.size(), data_is_ccw);
+		} else {
+			ret = parseText(file.data(), file.size(), data_is_ccw);
+		}
+	}
+
+	if (!ret) {
+		control_points.clear();
+		patch_data.clear();
+	}
+	updateGeometry();
+
+	return ret;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file patchmodel.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_PATCH_MODEL_H
+#define CORTEX_PATCH_MODEL_H
+
+#include "teaset.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Storage of the patches loaded by a @ref PatchModel.
+ *
+ * This is a base class of @ref PatchModel that precedes @ref Teaset, such
+ * that the geometry is constructed before it is passed to @ref Teaset.
+ */
+struct PatchModelStorage
+{
+	std::vector<Teaset::ControlPoint> control_points;
+	std::vector<Teaset::PatchData> patch_data;
+	Teaset::Geometry data{};
+};
+
+/**
+ * @brief Bicubic Bezier patch model loaded from a file.
+ *
+ * Two file layouts are supported:
+ * - Text, as used by the Newell teaset dataset: a patch count, one line of
+ *   16 comma separated one-based control point indices per patch, a control
+ *   point count and one line of comma separated x,y,z coordinates per
+ *   control point.
+ * - Binary, identified by @ref BinaryHeader::magic: the header followed by
+ *   16 zero-based @c uint32 indices per patch and three @c float
+ *   coordinates per control point, all little-endian. Values are
+ *   byte-swapped when loaded on big-endian hosts.
+ *
+ * The file is memory-mapped and the index and control point sections are
+ * parsed in parallel chunks directly from the mapping. The loaded model is
+ * tessellated like any other @ref Teaset.
+ */
+class PatchModel : private PatchModelStorage, public Teaset
+{
+public:
+	/**
+	 * @brief Header of the binary patch model layout.
+	 */
+	struct BinaryHeader
+	{
+		char magic[4]; ///< Must be @c BPCH
+		std::uint32_t version; ///< Must be 1
+		std::uint32_t patch_count;
+		std::uint32_t control_point_count;
+	};
+
+public:
+	PatchModel();
+	virtual ~PatchModel();
+
+	PatchModel(const PatchModel&) = delete;
+	PatchModel& operator=(const PatchModel&) = delete;
+
+	/**
+	 * @brief Load patch model from file @p filename.
+	 *
+	 * The layout is detected from the file content. Any previously loaded
+	 * patches are discarded, also on failure.
+	 *
+	 * @param filename Patch model file
+	 * @param data_is_ccw Boolean indicating whether the control points of
+	 *                    each patch are in counter-clockwise order. The
+	 *                    Newell teapot is not; its teacup and teaspoon are.
+	 * @return Boolean indicating success
+	 */
+	bool load(const std::string& filename, bool data_is_ccw = true);
+
+private:
+	bool parseText(const char* data, std::size_t size, bool data_is_ccw);
+	bool parseBinary(const char* data, std::size_t size, bool data_is_ccw);
+	void updateGeometry();
+};
+
+#endif
@@ -0,0 +1,746 @@
+/**
+ * @file scenecache.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "scenecache.h"
+#include "entity.h"
+#include "mappedfile.h"
+#include "material.h"
+#include "materialtable.h"
+#include "mesh.h"
+
+#include "glm/gtc/type_ptr.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr char cache_magic[8] = { 'C', 'O', 'R', 'T', 'E', 'X', 'S', 'C' };
+
+// Alignment of vertex and index blobs within the cache file
+constexpr std::uint64_t blob_alignment = 64;
+
+enum : std::uint32_t {
+	mesh_has_normals = 0x01,
+	mesh_has_tangents = 0x02,
+	mesh_has_bitangents = 0x04,
+	mesh_has_colors = 0x08,
+};
+
+constexpr std::uint32_t no_material = 0xFFFFFFFF;
+
+// Size, modification time and content hash of a file, or its absence
+struct file_stamp_t {
+	std::uint64_t size;
+	std::int64_t mtime;
+	std::uint64_t hash;
+	std::uint32_t exists;
+	std::uint32_t reserved;
+};
+
+struct header_t {
+	char magic[8];
+	std::uint32_t version;
+	std::uint32_t header_size;
+	file_stamp_t source;
+	std::uint64_t settings_digest;
+	std::uint32_t postprocess_flags;
+	std::uint32_t reserved;
+	std::uint32_t material_count;
+	std::uint32_t mesh_count;
+	std::uint32_t instance_count;
+	std::uint32_t dependency_count;
+	std::uint64_t file_size;
+};
+
+struct material_record_t {
+	std::uint32_t twosided;
+	std::uint32_t wireframe;
+	std::uint32_t shading_mode;
+	float ambient[3];
+	float diffuse[3];
+	float specular[3];
+	float shininess;
+};
+
+struct mesh_record_t {
+	std::uint32_t primitive_type;
+	std::uint32_t flags;
+	std::uint32_t material_index;
+	std::uint32_t reserved;
+	std::uint64_t vertex_offset;
+	std::uint64_t vertex_data_size; // Number of floats
+	std::uint64_t index_offset;
+	std::uint64_t index_data_size; // Number of indices
+	std::uint64_t meshlet_offset;
+	std::uint64_t meshlet_count;
+	std::uint64_t meshlet_vertex_offset;
+	std::uint64_t meshlet_vertex_count;
+	std::uint64_t meshlet_triangle_offset;
+	std::uint64_t meshlet_triangle_size; // Number of bytes
+	std::uint64_t lod_offset;
+	std::uint64_t lod_count;
+	float bounds_min[3];
+	float bounds_max[3];
+};
+
+struct instance_record_t {
+	std::uint32_t mesh_index;
+	float transform[16]; // Column-major
+};
+
+struct dependency_record_t {
+	std::uint64_t path_offset;
+	std::uint64_t path_size; // Number of bytes
+	file_stamp_t stamp;
+};
+
+static_assert(std::is_trivially_copyable<header_t>::value &&
+	std::is_trivially_copyable<material_record_t>::value &&
+	std::is_trivially_copyable<mesh_record_t>::value &&
+	std::is_trivially_copyable<instance_record_t>::value &&
+	std::is_trivially_copyable<dependency_record_t>::value &&
+	std::is_trivially_copyable<Meshlet>::value &&
+	std::is_trivially_copyable<Mesh::Lod>::value,
+	"Cache records must be trivially copyable"
+);
+
+// Modification time to write at an offset of the cache file
+struct restamp_t {
+	std::uint64_t offset;
+	std::int64_t mtime;
+};
+
+} // namespace
+
+static std::uint64_t alignOffset(std::uint64_t offset)
+{
+	return (offset + blob_alignment - 1) & ~(blob_alignment - 1);
+}
+
+static bool inBounds(std::uint64_t offset, std::uint64_t size, std::uint64_t file_size)
+{
+	return offset <= file_size && size <= file_size - offset;
+}
+
+// 64-bit FNV-1a hash, continued from @p hash
+static std::uint64_t hashData(const void* data, std::size_t size, std::uint64_t hash = 0xcbf29ce484222325)
+{
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	for (std::size_t i = 0; i < size; ++i) {
+		hash ^= p[i];
+		hash *= 0x100000001b3;
+	}
+
+	return hash;
+}
+
+static bool hashFile(const std::string& filename, std::uint64_t& hash)
+{
+	MappedFile file;
+	if (!file.open(filename)) {
+		return false;
+	}
+	hash = hashData(file.data(), file.size());
+
+	return true;
+}
+
+static std::uint64_t settingsDigest(const SceneCache::ImportSettings& settings)
+{
+	std::uint8_t optimize_meshes = settings.optimize_meshes;
+	std::uint64_t lod_count = settings.lod_ratios.size();
+
+	std::uint64_t digest = hashData(&optimize_meshes, sizeof(optimize_meshes));
+	digest = hashData(&lod_count, sizeof(lod_count), digest);
+	digest = hashData(settings.lod_ratios.data(), lod_count * sizeof(float), digest);
+
+	return digest;
+}
+
+// Size and modification time of @p filename, which must exist
+static bool getFileTimes(const std::string& filename, file_stamp_t& stamp)
+{
+	std::error_code ec;
+
+	stamp.size = std::filesystem::file_size(filename, ec);
+	if (ec) {
+		return false;
+	}
+
+	auto mtime = std::filesystem::last_write_time(filename, ec);
+	if (ec) {
+		return false;
+	}
+	stamp.mtime = mtime.time_since_epoch().count();
+
+	return true;
+}
+
+static bool stampFile(const std::string& filename, file_stamp_t& stamp)
+{
+	std::error_code ec;
+
+	stamp = file_stamp_t{};
+	if (!std::filesystem::exists(filename, ec)) {
+		// Missing files are stamped as such, unless they cannot be checked
+		return !ec;
+	}
+	stamp.exists = 1;
+
+	return getFileTimes(filename, stamp) && hashFile(filename, stamp.hash);
+}
+
+// Compare size and modification time first and fall back to the content
+// hash. Files with unchanged content but a new modification time are added
+// to @p restamps.
+static bool checkStamp(const std::string& filename, const file_stamp_t& stamp, std::uint64_t offset, std::vector<restamp_t>& restamps)
+{
+	std::error_code ec;
+	file_stamp_t current;
+
+	bool exists = std::filesystem::exists(filename, ec);
+	if (ec || exists != bool(stamp.exists)) {
+		return false;
+	}
+	if (!exists) {
+		return true;
+	}
+
+	if (!getFileTimes(filename, current) || current.size != stamp.size) {
+		return false;
+	}
+	if (current.mtime != stamp.mtime) {
+		if (!hashFile(filename, current.hash) || current.hash != stamp.hash) {
+			return false;
+		}
+		restamps.push_back({ offset + offsetof(file_stamp_t, mtime), current.mtime });
+	}
+
+	return true;
+}
+
+static bool writePadding(std::FILE* f, std::uint64_t& position, std::uint64_t target)
+{
+	static const char zero[blob_alignment] = {};
+
+	while (position < target) {
+		std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(target - position, sizeof(zero)));
+		if (std::fwrite(zero, 1, count, f) != count) {
+			return false;
+		}
+		position += count;
+	}
+
+	return true;
+}
+
+static bool writeData(std::FILE* f, std::uint64_t& position, const void* data, std::size_t size)
+{
+	if (size && std::fwrite(data, 1, size, f) != size) {
+		return false;
+	}
+	position += size;
+
+	return true;
+}
+
+static void storeColor(const Material::color3_t& color, float out[3])
+{
+	out[0] = color.r;
+	out[1] = color.g;
+	out[2] = color.b;
+}
+
+bool SceneCache::write(
+	const std::string& cache_filename,
+	const std::string& source_filename,
+	const Entity* entity,
+	const ImportSettings& settings,
+	const std::vector<std::string>& dependencies
+)
+{
+	header_t header{};
+	std::map<std::uint32_t, std::uint32_t> material_indices;
+	std::map<const Mesh*, std::uint32_t> mesh_indices;
+	std::vector<material_record_t> materials;
+	std::vector<mesh_record_t> meshes;
+	std::vector<const Mesh*> mesh_list;
+	std::vector<instance_record_t> instances;
+	std::vector<dependency_record_t> dependency_records;
+
+	if (!stampFile(source_filename, header.source) || !header.source.exists) {
+		return false;
+	}
+	std::memcpy(header.magic, cache_magic, sizeof(header.magic));
+	header.version = format_version;
+	header.header_size = sizeof(header);
+	header.settings_digest = settingsDigest(settings);
+	header.postprocess_flags = settings.postprocess_flags;
+
+	// Store only the materials used by the entity, which may share its
+	// material table with other entities
+	for (const Mesh* mesh : entity->meshes) {
+		if (mesh->material_index == Mesh::no_material ||
+			material_indices.count(mesh->material_index)
+		) {
+			continue;
+		}
+
+		Material material = entity->materials->get(mesh->material_index);
+		material_record_t record{};
+		record.twosided = material.twosided;
+		record.wireframe = material.wireframe;
+		record.shading_mode = static_cast<std::uint32_t>(material.shading_mode);
+		storeColor(material.ambient, record.ambient);
+		storeColor(material.diffuse, record.diffuse);
+		storeColor(material.specular, record.specular);
+		record.shininess = material.shininess;
+
+		material_indices[mesh->material_index] = materials.size();
+		materials.push_back(record);
+	}
+
+	// Dependency paths follow the record tables
+	std::uint64_t offset = sizeof(header) +
+		materials.size() * sizeof(material_record_t) +
+		entity->meshes.size() * sizeof(mesh_record_t) +
+		entity->instances.size() * sizeof(instance_record_t) +
+		dependencies.size() * sizeof(dependency_record_t);
+	for (const std::string& dependency : dependencies) {
+		dependency_record_t record{};
+		if (!stampFile(dependency, record.stamp)) {
+			return false;
+		}
+		record.path_offset = offset;
+		record.path_size = dependency.size();
+		offset += record.path_size;
+		dependency_records.push_back(record);
+	}
+
+	// Blobs follow the dependency paths
+	offset = alignOffset(offset);
+
+	for (const Mesh* mesh : entity->meshes) {
+		mesh_record_t record{};
+		record.primitive_type = static_cast<std::uint32_t>(mesh->primitive_type);
+		record.flags =
+			(mesh->normal_size ? mesh_has_normals : 0) |
+			(mesh->tangent_size ? mesh_has_tangents : 0) |
+			(mesh->bitangent_size ? mesh_has_bitangents : 0) |
+			(mesh->color_size ? mesh_has_colors : 0);
+		record.material_index = mesh->material_index != Mesh::no_material ? material_indices.at(mesh->material_index) : no_material;
+
+		record.vertex_offset = offset;
+		record.vertex_data_size = mesh->vertexDataSize();
+		offset = alignOffset(offset + record.vertex_data_size * sizeof(float));
+
+		record.index_offset = offset;
+		record.index_data_size = mesh->indexDataSize();
+		offset = alignOffset(offset + record.index_data_size * sizeof(unsigned int));
+
+		record.meshlet_offset = offset;
+		record.meshlet_count = mesh->meshlets.size();
+		offset = alignOffset(offset + record.meshlet_count * sizeof(Meshlet));
+
+		record.meshlet_vertex_offset = offset;
+		record.meshlet_vertex_count = mesh->meshlet_vertices.size();
+		offset = alignOffset(offset + record.meshlet_vertex_count * sizeof(unsigned int));
+
+		record.meshlet_triangle_offset = offset;
+		record.meshlet_triangle_size = mesh->meshlet_triangles.size();
+		offset = alignOffset(offset + record.meshlet_triangle_size);
+
+		record.lod_offset = offset;
+		record.lod_count = mesh->lods.size();
+		offset = alignOffset(offset + record.lod_count * sizeof(Mesh::Lod));
+
+		std::memcpy(record.bounds_min, mesh->bounds.min, sizeof(record.bounds_min));
+		std::memcpy(record.bounds_max, mesh->bounds.max, sizeof(record.bounds_max));
+
+		mesh_indices[mesh] = meshes.size();
+		meshes.push_back(record);
+		mesh_list.push_back(mesh);
+	}
+	header.file_size = offset;
+
+	for (const Entity::Instance& instance : entity->instances) {
+		instance_record_t record{};
+		record.mesh_index = mesh_indices.at(instance.mesh);
+		std::memcpy(record.transform, glm::value_ptr(instance.transform), sizeof(record.transform));
+		instances.push_back(record);
+	}
+
+	header.material_count = materials.size();
+	header.mesh_count = meshes.size();
+	header.instance_count = instances.size();
+	header.dependency_count = dependency_records.size();
+
+	// Write to temporary file and rename when complete
+	std::string tmp_filename = cache_filename + ".tmp";
+	std::FILE* f = std::fopen(tmp_filename.c_str(), "wb");
+	if (!f) {
+		return false;
+	}
+
+	std::uint64_t position = 0;
+	bool ret =
+		writeData(f, position, &header, sizeof(header)) &&
+		writeData(f, position, materials.data(), materials.size() * sizeof(material_record_t)) &&
+		writeData(f, position, meshes.data(), meshes.size() * sizeof(mesh_record_t)) &&
+		writeData(f, position, instances.data(), instances.size() * sizeof(instance_record_t)) &&
+		writeData(f, position, dependency_records.data(), dependency_records.size() * sizeof(dependency_record_t));
+	for (std::size_t i = 0; ret && i < dependencies.size(); ++i) {
+		ret = writeData(f, position, dependencies[i].data(), dependencies[i].size());
+	}
+
+	for (std::size_t i = 0; ret && i < mesh_list.size(); ++i) {
+		const Mesh* mesh = mesh_list[i];
+		const mesh_record_t& record = meshes[i];
+
+		ret =
+			writePadding(f, position, record.vertex_offset) &&
+			writeData(f, position, mesh->vertexData(), record.vertex_data_size * sizeof(float)) &&
+			writePadding(f, position, record.index_offset) &&
+			writeData(f, position, mesh->indexData(), record.index_data_size * sizeof(unsigned int)) &&
+			writePadding(f, position, record.meshlet_offset) &&
+			writeData(f, position, mesh->meshlets.data(), record.meshlet_count * sizeof(Meshlet)) &&
+			writePadding(f, position, record.meshlet_vertex_offset) &&
+			writeData(f, position, mesh->meshlet_vertices.data(), record.meshlet_vertex_count * sizeof(unsigned int)) &&
+			writePadding(f, position, record.meshlet_triangle_offset) &&
+			writeData(f, position, mesh->meshlet_triangles.data(), record.meshlet_triangle_size) &&
+			writePadding(f, position, record.lod_offset) &&
+			writeData(f, position, mesh->lods.data(), record.lod_count * sizeof(Mesh::Lod));
+	}
+	ret = ret && writePadding(f, position, header.file_size);
+
+	if (std::fclose(f) != 0) {
+		ret = false;
+	}
+	if (ret && std::rename(tmp_filename.c_str(), cache_filename.c_str()) != 0) {
+		ret = false;
+	}
+	if (!ret) {
+		std::remove(tmp_filename.c_str());
+	}
+
+	return ret;
+}
+
+static std::uint64_t tablesSize(const header_t& header)
+{
+	return sizeof(header) +
+		std::uint64_t(header.material_count) * sizeof(material_record_t) +
+		std::uint64_t(header.mesh_count) * sizeof(mesh_record_t) +
+		std::uint64_t(header.instance_count) * sizeof(instance_record_t) +
+		std::uint64_t(header.dependency_count) * sizeof(dependency_record_t);
+}
+
+// Validate the header and the stamps of the source file and its
+// dependencies. Stamps with outdated modification times are added to
+// @p restamps.
+static bool validateHeader(
+	const MappedFile* file,
+	const std::string& source_filename,
+	const SceneCache::ImportSettings& settings,
+	header_t& header,
+	std::vector<restamp_t>& restamps
+)
+{
+	if (file->size() < sizeof(header)) {
+		return false;
+	}
+	std::memcpy(&header, file->data(), sizeof(header));
+
+	if (std::memcmp(header.magic, cache_magic, sizeof(header.magic)) != 0 ||
+		header.version != SceneCache::format_version ||
+		header.header_size != sizeof(header) ||
+		header.file_size != file->size() ||
+		header.settings_digest != settingsDigest(settings) ||
+		header.postprocess_flags != settings.postprocess_flags ||
+		!inBounds(0, tablesSize(header), file->size())
+	) {
+		return false;
+	}
+
+	if (!header.source.exists ||
+		!checkStamp(source_filename, header.source, offsetof(header_t, source), restamps)
+	) {
+		return false;
+	}
+
+	std::uint64_t offset = tablesSize(header) - header.dependency_count * sizeof(dependency_record_t);
+	for (std::uint32_t i = 0; i < header.dependency_count; ++i, offset += sizeof(dependency_record_t)) {
+		dependency_record_t record;
+		std::memcpy(&record, file->data() + offset, sizeof(record));
+
+		if (!inBounds(record.path_offset, record.path_size, file->size())) {
+			return false;
+		}
+		std::string path(file->data() + record.path_offset, record.path_size);
+		if (!checkStamp(path, record.stamp, offset + offsetof(dependency_record_t, stamp), restamps)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Write the modification times of files that were found unchanged by
+// content, such that later reads do not hash them again. Failure is
+// harmless and only means that the files are hashed again.
+static void restampCache(const std::string& cache_filename, const MappedFile* file, const header_t& header, const std::vector<restamp_t>& restamps)
+{
+	std::uint64_t tables_size = tablesSize(header);
+	std::vector<char> tables(tables_size);
+
+	std::FILE* f = std::fopen(cache_filename.c_str(), "r+b");
+	if (!f) {
+		return;
+	}
+
+	// The cache file may have been replaced since it was mapped, in which
+	// case the new cache file is left as it is
+	if (std::fread(tables.data(), 1, tables_size, f) == tables_size &&
+		std::memcmp(tables.data(), file->data(), tables_size) == 0
+	) {
+		for (const restamp_t& restamp : restamps) {
+			if (std::fseek(f, static_cast<long>(restamp.offset), SEEK_SET) != 0 ||
+				std::fwrite(&restamp.mtime, sizeof(restamp.mtime), 1, f) != 1
+			) {
+				break;
+			}
+		}
+	}
+	std::fclose(f);
+}
+
+// Meshlets are small relative to the vertex data and are copied, such that
+// they can be rebuilt in place
+static bool readMeshlets(const MappedFile* file, const mesh_record_t& record, Mesh* mesh)
+{
+	if (record.meshlet_count > file->size() / sizeof(Meshlet) ||
+		record.meshlet_vertex_count > file->size() / sizeof(unsigned int) ||
+		!inBounds(record.meshlet_offset, record.meshlet_count * sizeof(Meshlet), file->size()) ||
+		!inBounds(record.meshlet_vertex_offset, record.meshlet_vertex_count * sizeof(unsigned int), file->size()) ||
+		!inBounds(record.meshlet_triangle_offset, record.meshlet_triangle_size, file->size())
+	) {
+		return false;
+	}
+
+	if (!record.meshlet_count) {
+		return true;
+	}
+
+	mesh->meshlets.resize(record.meshlet_count);
+	std::memcpy(mesh->meshlets.data(), file->data() + record.meshlet_offset, record.meshlet_count * sizeof(Meshlet));
+	mesh->meshlet_vertices.resize(record.meshlet_vertex_count);
+	if (record.meshlet_vertex_count) {
+		std::memcpy(mesh->meshlet_vertices.data(), file->data() + record.meshlet_vertex_offset, record.meshlet_vertex_count * sizeof(unsigned int));
+	}
+	mesh->meshlet_triangles.assign(
+		file->data() + record.meshlet_triangle_offset,
+		file->data() + record.meshlet_triangle_offset + record.meshlet_triangle_size
+	);
+
+	// Meshlets must stay within the meshlet lists and the vertex data
+	for (const Meshlet& meshlet : mesh->meshlets) {
+		if (meshlet.vertex_count > max_meshlet_vertices ||
+			meshlet.triangle_count > max_meshlet_triangles ||
+			meshlet.vertex_offset > record.meshlet_vertex_count ||
+			meshlet.vertex_count > record.meshlet_vertex_count - meshlet.vertex_offset ||
+			meshlet.triangle_offset > record.meshlet_triangle_size ||
+			meshlet.triangle_count * 3 > record.meshlet_triangle_size - meshlet.triangle_offset
+		) {
+			return false;
+		}
+	}
+	for (unsigned int vertex : mesh->meshlet_vertices) {
+		if (vertex >= mesh->vertexCount()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool readLods(const MappedFile* file, const mesh_record_t& record, Mesh* mesh)
+{
+	if (record.lod_count > file->size() / sizeof(Mesh::Lod) ||
+		!inBounds(record.lod_offset, record.lod_count * sizeof(Mesh::Lod), file->size())
+	) {
+		return false;
+	}
+	if (!record.lod_count) {
+		return true;
+	}
+
+	mesh->lods.resize(record.lod_count);
+	std::memcpy(mesh->lods.data(), file->data() + record.lod_offset, record.lod_count * sizeof(Mesh::Lod));
+
+	// Levels must stay within the index data
+	for (const Mesh::Lod& lod : mesh->lods) {
+		if (lod.index_offset > record.index_data_size ||
+			lod.index_count > record.index_data_size - lod.index_offset
+		) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Meshes are created in the entity arena and are released with the entity,
+// including meshes that fail validation
+static Mesh* readMesh(const MappedFile* file, const mesh_record_t& record, const std::vector<std::uint32_t>& materials, Entity* entity)
+{
+	if (record.primitive_type < static_cast<std::uint32_t>(Mesh::PrimitiveType::Point) ||
+		record.primitive_type > static_cast<std::uint32_t>(Mesh::PrimitiveType::Triangle) ||
+		(record.material_index != no_material && record.material_index >= materials.size()) ||
+		record.vertex_data_size > file->size() / sizeof(float) ||
+		record.index_data_size > file->size() / sizeof(unsigned int) ||
+		record.vertex_offset % alignof(float) ||
+		record.index_offset % alignof(unsigned int) ||
+		!inBounds(record.vertex_offset, record.vertex_data_size * sizeof(float), file->size()) ||
+		!inBounds(record.index_offset, record.index_data_size * sizeof(unsigned int), file->size())
+	) {
+		return nullptr;
+	}
+
+	// Vertex count is zero to avoid reserving vertex data
+	Mesh* mesh = entity->createMesh(
+		static_cast<Mesh::PrimitiveType>(record.primitive_type),
+		0,
+		record.flags & mesh_has_normals,
+		record.flags & mesh_has_tangents,
+		record.flags & mesh_has_bitangents,
+		record.flags & mesh_has_colors
+	);
+	if (record.vertex_data_size % mesh->stride) {
+		return nullptr;
+	}
+
+	mesh->setExternalData(
+		reinterpret_cast<const float*>(file->data() + record.vertex_offset),
+		record.vertex_data_size,
+		reinterpret_cast<const unsigned int*>(file->data() + record.index_offset),
+		record.index_data_size
+	);
+
+	// Indices must stay within the vertex data
+	const unsigned int* indices = mesh->indexData();
+	for (std::size_t i = 0; i < mesh->indexDataSize(); ++i) {
+		if (indices[i] >= mesh->vertexCount()) {
+			return nullptr;
+		}
+	}
+	if (record.material_index != no_material) {
+		mesh->material_index = materials[record.material_index];
+	}
+	std::memcpy(mesh->bounds.min, record.bounds_min, sizeof(record.bounds_min));
+	std::memcpy(mesh->bounds.max, record.bounds_max, sizeof(record.bounds_max));
+	mesh->bounds.updateSphere();
+	if (!readMeshlets(file, record, mesh) || !readLods(file, record, mesh)) {
+		return nullptr;
+	}
+
+	return mesh;
+}
+
+Entity* SceneCache::read(
+	const std::string& cache_filename,
+	const std::string& source_filename,
+	const std::string& name,
+	std::shared_ptr<MaterialTable> materials,
+	const ImportSettings& settings
+)
+{
+	header_t header;
+	std::vector<restamp_t> restamps;
+	MappedFile* file = new MappedFile;
+
+	if (!file->open(cache_filename, false) || !validateHeader(file, source_filename, settings, header, restamps)) {
+		delete file;
+		return nullptr;
+	}
+
+	// The entity owns the mapping from here on
+	Entity* entity = new Entity(name, std::move(materials));
+	entity->storage = file;
+
+	// Cached materials are interned and mapped to their table index
+	std::vector<std::uint32_t> material_indices;
+	const char* p = file->data() + sizeof(header);
+	material_indices.reserve(header.material_count);
+	for (std::uint32_t i = 0; i < header.material_count; ++i, p += sizeof(material_record_t)) {
+		material_record_t record;
+		std::memcpy(&record, p, sizeof(record));
+
+		if (record.shading_mode > static_cast<std::uint32_t>(Material::ShadingMode::BlinnPhong)) {
+			delete entity;
+			return nullptr;
+		}
+
+		Material material;
+		material.twosided = record.twosided;
+		material.wireframe = record.wireframe;
+		material.shading_mode = static_cast<Material::ShadingMode>(record.shading_mode);
+		material.ambient = Material::color3_t(record.ambient[0], record.ambient[1], record.ambient[2]);
+		material.diffuse = Material::color3_t(record.diffuse[0], record.diffuse[1], record.diffuse[2]);
+		material.specular = Material::color3_t(record.specular[0], record.specular[1], record.specular[2]);
+		material.shininess = record.shininess;
+		material_indices.push_back(entity->materials->intern(material));
+	}
+
+	std::vector<Mesh*> meshes;
+	meshes.reserve(header.mesh_count);
+	for (std::uint32_t i = 0; i < header.mesh_count; ++i, p += sizeof(mesh_record_t)) {
+		mesh_record_t record;
+		std::memcpy(&record, p, sizeof(record));
+
+		Mesh* mesh = readMesh(file, record, material_indices, entity);
+		if (!mesh) {
+			delete entity;
+			return nullptr;
+		}
+		entity->meshes.push_back(mesh);
+		meshes.push_back(mesh);
+	}
+
+	entity->instances.reserve(header.instance_count);
+	for (std::uint32_t i = 0; i < header.instance_count; ++i, p += sizeof(instance_record_t)) {
+		instance_record_t record;
+		std::memcpy(&record, p, sizeof(record));
+
+		if (record.mesh_index >= meshes.size()) {
+			delete entity;
+			return nullptr;
+		}
+
+		Entity::Instance instance;
+		instance.mesh = meshes[record.mesh_index];
+		instance.transform = glm::make_mat4(record.transform);
+		entity->instances.push_back(instance);
+	}
+	entity->updateBounds();
+
+	if (!restamps.empty()) {
+		restampCache(cache_filename, file, header, restamps);
+	}
+
+	return entity;
+}
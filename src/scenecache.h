@@ -0,0 +1,95 @@
+/**
+ * @file scenecache.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_SCENE_CACHE_H
+#define CORTEX_SCENE_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Forward declarations
+class Entity;
+class MaterialTable;
+
+/**
+ * @brief Binary cache of imported entities.
+ *
+ * The cache file stores the materials, meshes and instances of an
+ * @ref Entity as fixed-size records, followed by the vertex, index,
+ * meshlet and level of detail data of every mesh as 64-byte aligned blobs.
+ * Reading a cache file maps it into memory and the meshes of the resulting
+ * entity refer to the mapped vertex and index data without copying. The
+ * entity keeps the mapping alive.
+ *
+ * A cache file is only used if it was written by the same
+ * @ref format_version, for the same source file and with the same
+ * @ref ImportSettings. The source file and every dependency that was
+ * accessed while importing it, such as material libraries and textures,
+ * are stamped with their size, modification time and content hash. A file
+ * is considered unchanged if its size and modification time match.
+ * Otherwise its content hash is compared, such that touched or copied
+ * files do not invalidate the cache, and the cache file is stamped with
+ * the new modification time such that the file is not hashed again.
+ * Dependencies that were missing must still be missing.
+ */
+class SceneCache
+{
+public:
+	/// Version of the cache file format. Increment on any layout change.
+	static constexpr std::uint32_t format_version = 6;
+
+	/// Settings that change the imported entity and therefore the cache
+	struct ImportSettings {
+		bool optimize_meshes;
+		std::vector<float> lod_ratios;
+		unsigned int postprocess_flags; ///< @c aiPostProcessSteps flags
+	};
+
+	/**
+	 * @brief Write @p entity imported from @p source_filename with
+	 *        @p settings to cache file @p cache_filename.
+	 *
+	 * The @p dependencies are the other files accessed while importing,
+	 * including files that were looked for but did not exist.
+	 *
+	 * The cache file is written to a temporary file first and renamed when
+	 * complete, such that readers never observe a partial cache file.
+	 *
+	 * @return Boolean indicating success
+	 */
+	static bool write(
+		const std::string& cache_filename,
+		const std::string& source_filename,
+		const Entity* entity,
+		const ImportSettings& settings = ImportSettings{},
+		const std::vector<std::string>& dependencies = {}
+	);
+
+	/**
+	 * @brief Read entity named @p name from cache file @p cache_filename.
+	 *
+	 * The cached materials are interned into @p materials, or into a new
+	 * material table if nullptr.
+	 *
+	 * @return New entity, or nullptr if the cache file is missing, invalid,
+	 *         written with other @p settings or out of date with respect to
+	 *         @p source_filename or its dependencies.
+	 */
+	static Entity* read(
+		const std::string& cache_filename,
+		const std::string& source_filename,
+		const std::string& name,
+		std::shared_ptr<MaterialTable> materials = nullptr,
+		const ImportSettings& settings = ImportSettings{}
+	);
+};
+
+#endif
@@ -1,7 +1,7 @@
 /**
  * @file sceneloader.cc
  *
- * Copyright (c) 2013 Leon Lynch
+ * Copyright (c) 2013, 2026 Leon Lynch
  *
  * This file is licensed under the terms of the MIT license.
  * See LICENSE file.
@@ -9,15 +9,37 @@
 
 #include "sceneloader.h"
 #include "entity.h"
+#include "indexoptimizer.h"
+#include "mappedio.h"
 #include "material.h"
+#include "materialtable.h"
 #include "mesh.h"
+#include "meshlet.h"
+#include "scenecache.h"
+#include "simplifier.h"
+#include "threadpool.h"
+#include "vertextransform.h"
 
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
-#include <assimp/postprocess.h>
 #include <assimp/scene.h>
 
+#include "glm/gtc/type_ptr.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 SceneLoader::SceneLoader(bool logger, bool verbose)
+: settings{ false, 0, true, { 0.5f, 0.25f, 0.12f } },
+  material_table(std::make_shared<MaterialTable>())
 {
 	if (logger) {
 		if (verbose) {
@@ -33,9 +55,13 @@ SceneLoader::~SceneLoader()
 	Assimp::DefaultLogger::kill();
 }
 
-static bool loadMaterials(const aiScene* scene, Entity* entity)
+/**
+ * Intern the materials of @p scene into @p materials and map every scene
+ * material index to its table index in @p material_indices.
+ */
+static bool loadMaterials(const aiScene* scene, MaterialTable& materials, std::vector<std::uint32_t>& material_indices)
 {
-	entity->materials.reserve(scene->mNumMaterials);
+	material_indices.reserve(scene->mNumMaterials);
 	for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
 		const aiMaterial* ai_material = scene->mMaterials[i];
 
@@ -48,164 +74,692 @@ static bool loadMaterials(const aiScene* scene, Entity* entity)
 		float shininess;
 		float shininess_strength;
 
-		Material* material = new Material;
+		Material material;
 
 		ret = ai_material->Get(AI_MATKEY_TWOSIDED, twosided);
 		if (ret == aiReturn_SUCCESS) {
-			material->twosided = !!twosided;
+			material.twosided = !!twosided;
 		}
 
 		ret = ai_material->Get(AI_MATKEY_SHADING_MODEL, shading);
 		if (ret == aiReturn_SUCCESS) {
 			switch (shading) {
-				case aiShadingMode_Gouraud: material->shading_mode = Material::ShadingMode::Gouraud; break;
-				case aiShadingMode_Phong: material->shading_mode = Material::ShadingMode::BlinnPhong; break;
-				case aiShadingMode_Blinn: material->shading_mode = Material::ShadingMode::BlinnPhong; break;
-				default: material->shading_mode = Material::ShadingMode::None; break;
+				case aiShadingMode_Gouraud: material.shading_mode = Material::ShadingMode::Gouraud; break;
+				case aiShadingMode_Phong: material.shading_mode = Material::ShadingMode::BlinnPhong; break;
+				case aiShadingMode_Blinn: material.shading_mode = Material::ShadingMode::BlinnPhong; break;
+				default: material.shading_mode = Material::ShadingMode::None; break;
 			}
 		}
 
 		ret = ai_material->Get(AI_MATKEY_COLOR_AMBIENT, ambient);
 		if (ret == aiReturn_SUCCESS) {
-			material->ambient = Material::color3_t(ambient.r, ambient.g, ambient.b);
+			material.ambient = Material::color3_t(ambient.r, ambient.g, ambient.b);
 		}
 
 		ret = ai_material->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse);
 		if (ret == aiReturn_SUCCESS) {
-			material->diffuse = Material::color3_t(diffuse.r, diffuse.g, diffuse.b);
+			material.diffuse = Material::color3_t(diffuse.r, diffuse.g, diffuse.b);
 		}
 
 		ret = ai_material->Get(AI_MATKEY_COLOR_SPECULAR, specular);
 		if (ret == aiReturn_SUCCESS) {
-			material->specular = Material::color3_t(specular.r, specular.g, specular.b);
+			material.specular = Material::color3_t(specular.r, specular.g, specular.b);
 		}
 
 		ret = ai_material->Get(AI_MATKEY_SHININESS, shininess);
 		if (ret == aiReturn_SUCCESS) {
-			material->shininess = shininess;
+			material.shininess = shininess;
 		}
 
 		ret = ai_material->Get(AI_MATKEY_SHININESS_STRENGTH, shininess_strength);
 		if (ret == aiReturn_SUCCESS) {
-			material->shininess *= shininess_strength;
+			material.shininess *= shininess_strength;
 		}
 
 		// update shading mode
-		if (material->shading_mode == Material::ShadingMode::None) {
-			material->setDefaultShadingMode();
+		if (material.shading_mode == Material::ShadingMode::None) {
+			material.setDefaultShadingMode();
 		}
 
-		entity->materials.push_back(material);
+		material_indices.push_back(materials.intern(material));
 	}
 
 	return true;
 }
 
-static bool loadMeshesFromNode(const aiScene* scene, aiMatrix4x4 current_transformation, const aiNode* node, Entity* entity)
+/**
+ * Copy @p count tightly packed elements of @p Size components from @p src
+ * into interleaved vertex data @p dst at component @p offset of each vertex.
+ * The fixed element size allows the compiler to emit straight vector moves
+ * without per-element capacity checks.
+ */
+template<std::size_t Size, typename T>
+static void interleaveAttribute(const T* src, std::size_t count, float* dst, std::size_t offset, std::size_t stride)
 {
-	aiMatrix4x4 node_transformation = current_transformation * node->mTransformation;
+	for (std::size_t i = 0; i < count; ++i) {
+		const T* element = src + i * Size;
+		float* vertex = dst + i * stride + offset;
+		for (std::size_t c = 0; c < Size; ++c) {
+			vertex[c] = static_cast<float>(element[c]);
+		}
+	}
+}
 
-	for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
-		const aiMesh* ai_mesh = scene->mMeshes[node->mMeshes[i]];
-		Mesh::PrimitiveType primitive_type;
-
-		switch (ai_mesh->mPrimitiveTypes) {
-			case aiPrimitiveType_POINT: primitive_type = Mesh::PrimitiveType::Point; break;
-			case aiPrimitiveType_LINE: primitive_type = Mesh::PrimitiveType::Line; break;
-			case aiPrimitiveType_TRIANGLE: primitive_type = Mesh::PrimitiveType::Triangle; break;
-			default:
-				continue; // unsupported primitive type; skip mesh
-		}
-
-		Mesh* mesh = new Mesh(
-			primitive_type,
-			ai_mesh->mNumVertices,
-			!!ai_mesh->mNormals,
-			!!ai_mesh->mTangents,
-			!!ai_mesh->mBitangents,
-			!!ai_mesh->mColors[0]
-		);
+static_assert(std::is_same<ai_real, float>::value, "Double precision Assimp builds are not supported");
 
-		// load mesh vertex data
-		for (unsigned int i = 0; i < ai_mesh->mNumVertices; ++i) {
-			aiVector3D ai_vertex = ai_mesh->mVertices[i];
+/**
+ * Node transformation for positions, normals, tangents and bitangents, in
+ * the row-major layout expected by the vertex transform kernels.
+ */
+struct NodeTransform
+{
+	const float* model_matrix;
+	bool identity;
+	float tangent_matrix[9];
+	float normal_matrix[9];
+
+	NodeTransform(const aiMatrix4x4& transformation)
+	: model_matrix(&transformation.a1),
+	  identity(matrixIsIdentity(model_matrix))
+	{
+		for (std::size_t i = 0; i < 9; ++i) {
+			tangent_matrix[i] = model_matrix[(i / 3) * 4 + (i % 3)];
+		}
+		normalMatrix(model_matrix, normal_matrix);
+	}
+};
 
-			// apply node transformation
-			ai_vertex *= node_transformation;
+/**
+ * Size the vertex data of @p mesh once and interleave each attribute stream
+ * of @p ai_mesh into place. Positions, normals, tangents and bitangents are
+ * transformed to the space of the root node in batches, unless the node
+ * transformation is the identity. The mesh bounds are computed while the
+ * positions are written.
+ */
+static void loadVertexData(const aiMesh* ai_mesh, const NodeTransform& transform, Mesh* mesh)
+{
+	std::size_t vertex_count = ai_mesh->mNumVertices;
+	std::size_t stride = mesh->stride;
+	std::size_t offset = 0;
 
-			mesh->vertex_data.insert(mesh->vertex_data.end(), { ai_vertex.x, ai_vertex.y, ai_vertex.z });
+	mesh->vertex_data.resize(vertex_count * stride);
+	if (!vertex_count) {
+		return;
+	}
+	float* vertex_data = mesh->vertex_data.data();
 
-			if (ai_mesh->mNormals) {
-				const aiVector3D& ai_normal = ai_mesh->mNormals[i];
-				mesh->vertex_data.insert(mesh->vertex_data.end(), { ai_normal.x, ai_normal.y, ai_normal.z });
-			}
+	Bounds& bounds = mesh->bounds;
+	if (transform.identity) {
+		copyPoints(&ai_mesh->mVertices[0].x, vertex_count, vertex_data + offset, stride, bounds.min, bounds.max);
+	} else {
+		transformPoints(transform.model_matrix, &ai_mesh->mVertices[0].x, vertex_count, vertex_data + offset, stride, bounds.min, bounds.max);
+	}
+	bounds.updateSphere();
+	offset += mesh->vertex_size;
+
+	const std::pair<const aiVector3D*, const float*> vector_streams[] = {
+		{ ai_mesh->mNormals, transform.normal_matrix },
+		{ ai_mesh->mTangents, transform.tangent_matrix },
+		{ ai_mesh->mBitangents, transform.tangent_matrix },
+	};
+	for (auto&& [ai_vectors, matrix] : vector_streams) {
+		if (!ai_vectors) {
+			continue;
+		}
 
-			if (ai_mesh->mTangents) {
-				const aiVector3D& ai_tangent = ai_mesh->mTangents[i];
-				mesh->vertex_data.insert(mesh->vertex_data.end(), { ai_tangent.x, ai_tangent.y, ai_tangent.z });
-			}
+		if (transform.identity) {
+			interleaveAttribute<3>(&ai_vectors[0].x, vertex_count, vertex_data, offset, stride);
+		} else {
+			transformVectors(matrix, true, &ai_vectors[0].x, vertex_count, vertex_data + offset, stride);
+		}
+		offset += 3;
+	}
 
-			if (ai_mesh->mBitangents) {
-				const aiVector3D& ai_bitangent = ai_mesh->mBitangents[i];
-				mesh->vertex_data.insert(mesh->vertex_data.end(), { ai_bitangent.x, ai_bitangent.y, ai_bitangent.z });
-			}
+	if (ai_mesh->mColors[0]) {
+		interleaveAttribute<4>(&ai_mesh->mColors[0][0].r, vertex_count, vertex_data, offset, stride);
+		offset += mesh->color_size;
+	}
+}
 
-			if (ai_mesh->mColors[0]) {
-				const aiColor4D& ai_color = ai_mesh->mColors[0][i];
-				mesh->vertex_data.insert(mesh->vertex_data.end(), { ai_color.r, ai_color.g, ai_color.b, ai_color.a });
-			}
-		}
+static Mesh* loadMesh(
+	const aiMesh* ai_mesh,
+	const aiMatrix4x4& transformation,
+	const std::vector<std::uint32_t>& material_indices,
+	Entity* entity
+)
+{
+	Mesh::PrimitiveType primitive_type;
+
+	switch (ai_mesh->mPrimitiveTypes) {
+		case aiPrimitiveType_POINT: primitive_type = Mesh::PrimitiveType::Point; break;
+		case aiPrimitiveType_LINE: primitive_type = Mesh::PrimitiveType::Line; break;
+		case aiPrimitiveType_TRIANGLE: primitive_type = Mesh::PrimitiveType::Triangle; break;
+		default:
+			return nullptr; // unsupported primitive type; skip mesh
+	}
 
-		// load mesh index
-		mesh->index_data.reserve(ai_mesh->mNumFaces * (unsigned int)primitive_type);
-		for (unsigned int i = 0; i < ai_mesh->mNumFaces; ++i) {
-			const aiFace& ai_face = ai_mesh->mFaces[i];
+	Mesh* mesh = entity->createMesh(
+		primitive_type,
+		ai_mesh->mNumVertices,
+		!!ai_mesh->mNormals,
+		!!ai_mesh->mTangents,
+		!!ai_mesh->mBitangents,
+		!!ai_mesh->mColors[0]
+	);
+
+	// load mesh vertex data
+	loadVertexData(ai_mesh, NodeTransform(transformation), mesh);
+
+	// add material
+	if (ai_mesh->mMaterialIndex < material_indices.size()) {
+		mesh->material_index = material_indices[ai_mesh->mMaterialIndex];
+	}
+
+	return mesh;
+}
 
-			if (ai_face.mNumIndices != (unsigned int)primitive_type)
-				continue;
+/**
+ * Load the indices of the faces of @p ai_mesh that match @p primitive_type
+ * into @p indices, which is sized once by counting those faces first. The
+ * container is either the index data of the mesh or scratch space.
+ */
+template<typename Container>
+static void loadIndexData(const aiMesh* ai_mesh, Mesh::PrimitiveType primitive_type, Container& indices)
+{
+	unsigned int face_size = static_cast<unsigned int>(primitive_type);
+	std::size_t face_count = 0;
 
-			mesh->index_data.insert(mesh->index_data.end(), ai_face.mIndices, ai_face.mIndices + ai_face.mNumIndices);
+	for (unsigned int i = 0; i < ai_mesh->mNumFaces; ++i) {
+		if (ai_mesh->mFaces[i].mNumIndices == face_size) {
+			++face_count;
 		}
+	}
+
+	indices.clear();
+	indices.reserve(face_count * face_size);
+	for (unsigned int i = 0; i < ai_mesh->mNumFaces; ++i) {
+		const aiFace& ai_face = ai_mesh->mFaces[i];
 
-		// add material
-		mesh->material = entity->materials[ai_mesh->mMaterialIndex];
+		if (ai_face.mNumIndices != face_size)
+			continue;
 
-		// store mesh
-		entity->meshes.push_back(mesh);
+		indices.insert(indices.end(), ai_face.mIndices, ai_face.mIndices + ai_face.mNumIndices);
+	}
+}
+
+/**
+ * Estimate the arena storage of the mesh converted from @p ai_mesh, which
+ * is the mesh itself, its vertex and index data, including levels of
+ * detail, and its meshlets.
+ */
+static std::size_t estimateMeshSize(const aiMesh* ai_mesh, const std::vector<float>& lod_ratios)
+{
+	std::size_t stride = 3;
+	for (bool present : { !!ai_mesh->mNormals, !!ai_mesh->mTangents, !!ai_mesh->mBitangents }) {
+		stride += present ? 3 : 0;
+	}
+	stride += ai_mesh->mColors[0] ? 4 : 0;
+
+	// Mesh and its 6 arrays, each with alignment padding
+	std::size_t size = sizeof(Mesh) + 7 * alignof(std::max_align_t);
+	size += ai_mesh->mNumVertices * stride * sizeof(float);
+
+	std::size_t index_count = ai_mesh->mNumFaces;
+	switch (ai_mesh->mPrimitiveTypes) {
+		case aiPrimitiveType_POINT: break;
+		case aiPrimitiveType_LINE: index_count *= 2; break;
+		case aiPrimitiveType_TRIANGLE: index_count *= 3; break;
+		default:
+			return 0; // unsupported primitive type; skipped
+	}
+	if (ai_mesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) {
+		return size + index_count * sizeof(unsigned int);
+	}
+
+	float lod_scale = 1.0f;
+	for (float ratio : lod_ratios) {
+		lod_scale += ratio;
+	}
+	size += static_cast<std::size_t>(index_count * lod_scale) * sizeof(unsigned int);
+
+	// Meshlets store one byte per level 0 index and reference each vertex
+	// about once, apart from vertices shared across meshlet borders
+	std::size_t meshlet_count = (ai_mesh->mNumFaces + max_meshlet_triangles - 1) / max_meshlet_triangles;
+	size += meshlet_count * sizeof(Meshlet);
+	size += (ai_mesh->mNumVertices + meshlet_count * max_meshlet_vertices / 2) * sizeof(unsigned int);
+	size += index_count;
+
+	return size;
+}
+
+/**
+ * Reference from a node to a mesh of the scene, with the transformation of
+ * the node relative to the root node.
+ */
+struct MeshReference
+{
+	unsigned int mesh_index;
+	aiMatrix4x4 transformation;
+};
+
+static void collectMeshReferences(const aiNode* node, const aiMatrix4x4& parent_transformation, std::vector<MeshReference>& references)
+{
+	aiMatrix4x4 node_transformation = parent_transformation * node->mTransformation;
+
+	for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
+		references.push_back({ node->mMeshes[i], node_transformation });
 	}
 
 	for (unsigned int i = 0; i < node->mNumChildren; ++i) {
-		loadMeshesFromNode(scene, node_transformation, node->mChildren[i], entity);
+		collectMeshReferences(node->mChildren[i], node_transformation, references);
+	}
+}
+
+/**
+ * Callback invoked by the conversion threads for every converted mesh, with
+ * the number of meshes converted so far and in total. Returning false skips
+ * the remaining conversions.
+ */
+using MeshConvertedCallback = std::function<bool(const Mesh* mesh, std::size_t converted, std::size_t total)>;
+
+static bool loadMeshes(
+	const aiScene* scene,
+	ThreadPool& pool,
+	bool optimize,
+	const std::vector<float>& lod_ratios,
+	const std::vector<std::uint32_t>& material_indices,
+	const MeshConvertedCallback& converted,
+	Entity* entity
+)
+{
+	std::vector<MeshReference> references;
+	std::vector<unsigned int> reference_count(scene->mNumMeshes, 0);
+	std::vector<const MeshReference*> jobs;
+	std::vector<Mesh*> meshes(scene->mNumMeshes, nullptr);
+	std::vector<VertexCacheStatistics> stats_before(scene->mNumMeshes);
+	std::vector<VertexCacheStatistics> stats_after(scene->mNumMeshes);
+	std::atomic<std::size_t> converted_count(0);
+	std::atomic<bool> stopped(false);
+
+	// Flatten node tree into mesh references
+	collectMeshReferences(scene->mRootNode, aiMatrix4x4(), references);
+	for (auto&& reference : references) {
+		if (reference_count[reference.mesh_index]++ == 0) {
+			// First reference; convert mesh in order of first reference
+			jobs.push_back(&reference);
+		}
+	}
+
+	// Place the meshes in a shared arena block that is sized from the scene
+	// totals, instead of a block or more per large array
+	std::size_t arena_size = 0;
+	for (auto&& job : jobs) {
+		arena_size += estimateMeshSize(scene->mMeshes[job->mesh_index], lod_ratios);
+	}
+	entity->arena.reserve(arena_size);
+
+	// Convert meshes concurrently. Each job writes only its own slot.
+	pool.parallelFor(jobs.size(), [&](std::size_t i) {
+		if (stopped) {
+			return;
+		}
+		unsigned int mesh_index = jobs[i]->mesh_index;
+
+		// Meshes referenced by a single node are transformed to entity space
+		// during conversion. Shared meshes remain in mesh space and are
+		// placed by their instance transforms.
+		bool shared = reference_count[mesh_index] > 1;
+
+		meshes[mesh_index] = loadMesh(
+			scene->mMeshes[mesh_index],
+			shared ? aiMatrix4x4() : jobs[i]->transformation,
+			material_indices,
+			entity
+		);
+
+		// Load indices, optimize, simplify and cluster before the mesh is
+		// published to asynchronous loads, because they read the data while
+		// later meshes are still being converted. Meshlets are built from
+		// the optimized triangle order of the full detail level. Level 0 of
+		// meshes with levels of detail is kept in scratch space until all
+		// levels are known, such that the index data in the entity arena is
+		// sized once.
+		Mesh* mesh = meshes[mesh_index];
+		if (mesh) {
+			const aiMesh* ai_mesh = scene->mMeshes[mesh_index];
+
+			if (!lod_ratios.empty() && mesh->primitive_type == Mesh::PrimitiveType::Triangle) {
+				std::vector<unsigned int> indices;
+				loadIndexData(ai_mesh, mesh->primitive_type, indices);
+				if (optimize) {
+					optimizeMesh(mesh, indices, &stats_before[mesh_index], &stats_after[mesh_index]);
+				}
+				buildLods(mesh, indices, lod_ratios);
+			} else {
+				loadIndexData(ai_mesh, mesh->primitive_type, mesh->index_data);
+				if (optimize) {
+					optimizeMesh(mesh, &stats_before[mesh_index], &stats_after[mesh_index]);
+				}
+			}
+			buildMeshlets(mesh);
+		}
+
+		if (converted &&
+			!converted(meshes[mesh_index], ++converted_count, jobs.size())
+		) {
+			stopped = true;
+		}
+	});
+
+	// Assemble entity in deterministic order
+	VertexCacheStatistics total_before;
+	VertexCacheStatistics total_after;
+	entity->meshes.reserve(jobs.size());
+	for (auto&& job : jobs) {
+		if (meshes[job->mesh_index]) {
+			entity->meshes.push_back(meshes[job->mesh_index]);
+			total_before += stats_before[job->mesh_index];
+			total_after += stats_after[job->mesh_index];
+		}
 	}
 
+	if (optimize && total_before.triangle_count) {
+		Assimp::DefaultLogger::get()->info(
+			"Mesh optimization: ACMR ", total_before.acmr(), " -> ", total_after.acmr(),
+			", ATVR ", total_before.atvr(), " -> ", total_after.atvr()
+		);
+	}
+
+	for (auto&& reference : references) {
+		unsigned int mesh_index = reference.mesh_index;
+		if (!meshes[mesh_index]) {
+			continue;
+		}
+
+		// aiMatrix4x4 is row-major but glm::mat4 is column-major
+		Entity::Instance instance;
+		instance.mesh = meshes[mesh_index];
+		if (reference_count[mesh_index] > 1) {
+			instance.transform = glm::transpose(glm::make_mat4(&reference.transformation.a1));
+		} else {
+			instance.transform = glm::mat4(1.0f);
+		}
+		entity->instances.push_back(instance);
+	}
+	entity->updateBounds();
+
 	return true;
 }
 
-Entity* SceneLoader::createEntityFromFile(const std::string& name, const std::string& filename)
+Entity* SceneLoader::createEntityFromFile(
+	const std::string& name,
+	const std::string& filename,
+	const ImportProfile& profile
+)
+{
+	last_timings = ImportTimings();
+	return loadEntity(name, filename, profile, settings, material_table, last_timings, nullptr);
+}
+
+std::unique_ptr<SceneLoader::AsyncLoad> SceneLoader::createEntityFromFileAsync(
+	const std::string& name,
+	const std::string& filename,
+	const ImportProfile& profile
+)
+{
+	std::unique_ptr<AsyncLoad> async(new AsyncLoad);
+	AsyncLoad* load = async.get();
+
+	load->thread = std::thread([load, name, filename, profile, settings = settings, materials = material_table]() {
+		// Exceptions must not escape the thread
+		Entity* entity = nullptr;
+		try {
+			entity = loadEntity(name, filename, profile, settings, materials, load->load_timings, load);
+		} catch (const std::exception& e) {
+			Assimp::DefaultLogger::get()->error("Failed to load ", filename, ": ", e.what());
+		}
+		load->finish(entity);
+	});
+
+	return async;
+}
+
+/// Seconds elapsed since @p start
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+Entity* SceneLoader::loadEntity(
+	const std::string& name,
+	const std::string& filename,
+	const ImportProfile& profile,
+	const Settings& settings,
+	const std::shared_ptr<MaterialTable>& materials,
+	ImportTimings& timings,
+	AsyncLoad* async
+)
 {
 	bool ret;
 	Assimp::Importer importer;
 	const aiScene* scene;
+	std::string cache_filename = filename + ".cortexcache";
+	SceneCache::ImportSettings cache_settings{ settings.optimize_meshes, settings.lod_ratios, profile.flags };
+	MappedIOSystem* io;
+	ImportProgressHandler::Callback progress;
+	MeshConvertedCallback converted;
+	std::chrono::steady_clock::time_point start;
+
+	if (async) {
+		async->setStage(Stage::Parse);
+		progress = [async](bool postprocess, float stage_progress) {
+			async->setStage(postprocess ? Stage::PostProcess : Stage::Parse, stage_progress);
+			return !async->isCancelled();
+		};
+		converted = [async](const Mesh* mesh, std::size_t count, std::size_t total) {
+			if (mesh) {
+				async->addMesh(mesh);
+			}
+			async->setProgress(static_cast<float>(count) / total);
+			return !async->isCancelled();
+		};
+	}
+
+	if (settings.cache_enabled) {
+		Entity* entity = SceneCache::read(cache_filename, filename, name, materials, cache_settings);
+		if (entity) {
+			if (async) {
+				for (auto&& mesh : entity->meshes) {
+					async->addMesh(mesh);
+				}
+			}
+			return entity;
+		}
+	}
 
-	scene = importer.ReadFile(filename, aiProcessPreset_TargetRealtime_MaxQuality);
+	// The importer owns the file system and the progress handler
+	io = new MappedIOSystem;
+	importer.SetIOHandler(io);
+	importer.SetProgressHandler(new ImportProgressHandler(progress));
+
+	// Read and post-process separately, such that each is timed and a
+	// cancelled load stops before post-processing
+	start = std::chrono::steady_clock::now();
+	scene = importer.ReadFile(filename, 0);
+	timings.parse_seconds = secondsSince(start);
+	if (scene && !(async && async->isCancelled())) {
+		if (async) {
+			async->setStage(Stage::PostProcess);
+		}
+		scene = profile.apply(importer, timings);
+	}
+	if (async && async->isCancelled()) {
+		return nullptr;
+	}
 	if (!scene) {
 		Assimp::DefaultLogger::get()->error(importer.GetErrorString());
 		return nullptr;
 	}
 
-	Entity* entity = new Entity(name);
+	Entity* entity = new Entity(name, materials);
+	std::vector<std::uint32_t> material_indices;
 
-	ret = loadMaterials(scene, entity);
+	ret = loadMaterials(scene, *entity->materials, material_indices);
 	if (!ret) {
 		delete entity;
 		return nullptr;
 	}
 
-	ret = loadMeshesFromNode(scene, aiMatrix4x4(), scene->mRootNode, entity);
+	if (async) {
+		async->setStage(Stage::Convert);
+	}
+	start = std::chrono::steady_clock::now();
+	ThreadPool pool(settings.thread_count);
+	try {
+		ret = loadMeshes(scene, pool, settings.optimize_meshes, settings.lod_ratios, material_indices, converted, entity);
+	} catch (const std::exception& e) {
+		Assimp::DefaultLogger::get()->error("Failed to convert ", filename, ": ", e.what());
+		ret = false;
+	}
 	if (!ret) {
-		delete entity;
+		// Meshes that were already taken from an asynchronous load must
+		// remain valid until its handle is destroyed
+		if (async) {
+			async->keepPartialEntity(entity);
+		} else {
+			delete entity;
+		}
 		return nullptr;
 	}
+	timings.convert_seconds = secondsSince(start);
+
+	Assimp::DefaultLogger::get()->info("Imported ", filename, " using profile ", profile.name, ": ", timings.toString());
+	Assimp::DefaultLogger::get()->info(
+		"Entity ", name, " uses ", entity->arena.bytesUsed(), " of ",
+		entity->arena.bytesReserved(), " bytes of arena storage"
+	);
+
+	// A cancelled load returns its partial entity, which keeps the meshes
+	// that were already taken alive until the handle is destroyed
+	if (async && async->isCancelled()) {
+		return entity;
+	}
+
+	if (settings.cache_enabled) {
+		// Every other file accessed by the importer is a dependency
+		std::vector<std::string> dependencies;
+		for (const std::string& accessed : io->accessedFiles()) {
+			if (accessed != filename) {
+				dependencies.push_back(accessed);
+			}
+		}
+
+		ret = SceneCache::write(cache_filename, filename, entity, cache_settings, dependencies);
+		if (!ret) {
+			Assimp::DefaultLogger::get()->warn("Failed to write scene cache ", cache_filename);
+		}
+	}
 
 	return entity;
 }
+
+SceneLoader::AsyncLoad::AsyncLoad()
+: current_stage(Stage::Pending),
+  stage_progress(0.0f),
+  cancelled(false),
+  entity(nullptr),
+  partial_entity(nullptr)
+{
+}
+
+SceneLoader::AsyncLoad::~AsyncLoad()
+{
+	cancel();
+	if (thread.joinable()) {
+		thread.join();
+	}
+	delete entity;
+	delete partial_entity;
+}
+
+bool SceneLoader::AsyncLoad::finished() const
+{
+	Stage stage = current_stage;
+	return stage == Stage::Done || stage == Stage::Failed || stage == Stage::Cancelled;
+}
+
+void SceneLoader::AsyncLoad::wait()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	finished_cv.wait(lock, [this]() { return finished(); });
+}
+
+std::vector<const Mesh*> SceneLoader::AsyncLoad::takeMeshes(std::size_t byte_budget)
+{
+	std::vector<const Mesh*> meshes;
+	std::size_t bytes = 0;
+	std::lock_guard<std::mutex> lock(mutex);
+
+	while (!ready_meshes.empty()) {
+		const Mesh* mesh = ready_meshes.front();
+		std::size_t mesh_bytes =
+			mesh->vertexDataSize() * sizeof(float) +
+			mesh->indexDataSize() * sizeof(unsigned int);
+
+		if (!meshes.empty() && bytes + mesh_bytes > byte_budget) {
+			break;
+		}
+		meshes.push_back(mesh);
+		bytes += mesh_bytes;
+		ready_meshes.pop_front();
+	}
+
+	return meshes;
+}
+
+Entity* SceneLoader::AsyncLoad::takeEntity()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (current_stage != Stage::Done) {
+		return nullptr;
+	}
+
+	Entity* result = entity;
+	entity = nullptr;
+	return result;
+}
+
+void SceneLoader::AsyncLoad::setStage(Stage stage, float progress)
+{
+	current_stage = stage;
+	stage_progress = progress;
+}
+
+void SceneLoader::AsyncLoad::addMesh(const Mesh* mesh)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	ready_meshes.push_back(mesh);
+}
+
+void SceneLoader::AsyncLoad::keepPartialEntity(Entity* partial)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	partial_entity = partial;
+}
+
+void SceneLoader::AsyncLoad::finish(Entity* result)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		entity = result;
+		if (cancelled) {
+			current_stage = Stage::Cancelled;
+		} else if (entity) {
+			current_stage = Stage::Done;
+		} else {
+			current_stage = Stage::Failed;
+		}
+		stage_progress = 1.0f;
+	}
+	finished_cv.notify_all();
+}
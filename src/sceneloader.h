@@ -1,7 +1,7 @@
 /**
  * @file sceneloader.h
  *
- * Copyright (c) 2013 Leon Lynch
+ * Copyright (c) 2013, 2026 Leon Lynch
  *
  * This file is licensed under the terms of the MIT license.
  * See LICENSE file.
@@ -10,13 +10,40 @@
 #ifndef CORTEX_SCENE_LOADER_H
 #define CORTEX_SCENE_LOADER_H
 
+#include "importprofile.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
-// Forward declaration
+// Forward declarations
 class Entity;
+class MaterialTable;
+class Mesh;
 
 class SceneLoader
 {
+public:
+	/// Stage of a load in progress. See @ref AsyncLoad.
+	enum class Stage {
+		Pending,
+		Parse,
+		PostProcess,
+		Convert,
+		Done,
+		Failed,
+		Cancelled,
+	};
+
+	class AsyncLoad;
+
 public:
 	SceneLoader(bool logger = false, bool verbose = false);
 	virtual ~SceneLoader();
@@ -24,7 +51,181 @@ public:
 	SceneLoader(const SceneLoader&) = delete;
 	SceneLoader& operator=(const SceneLoader&) = delete;
 
-	Entity* createEntityFromFile(const std::string& name, const std::string& filename);
+	/**
+	 * Enable or disable the scene cache. When enabled, imported entities are
+	 * written to a binary cache file next to the source file, named by
+	 * appending @c .cortexcache, and later imports of the same unchanged
+	 * source file read the cache file instead of invoking Assimp. Changes to
+	 * the import profile, the mesh optimization or level of detail settings,
+	 * or to files the source file depends on, invalidate the cache file.
+	 * @see SceneCache
+	 */
+	void setCacheEnabled(bool enabled) { settings.cache_enabled = enabled; }
+
+	/**
+	 * Set the number of threads used to convert meshes, including the
+	 * calling thread. Zero, the default, selects the number of hardware
+	 * threads. The resulting entity does not depend on the thread count.
+	 */
+	void setThreadCount(std::size_t count) { settings.thread_count = count; }
+
+	/**
+	 * Enable or disable the optimization of triangle meshes for vertex
+	 * cache, overdraw and vertex fetch efficiency after conversion. Enabled
+	 * by default. The cache statistics before and after are logged.
+	 * @see optimizeTriangleList
+	 */
+	void setMeshOptimizationEnabled(bool enabled) { settings.optimize_meshes = enabled; }
+
+	/**
+	 * Set the triangle budgets of the levels of detail generated for
+	 * triangle meshes, as fractions of the full detail triangle count in
+	 * decreasing order. Defaults to 0.5, 0.25 and 0.12. An empty list
+	 * disables level of detail generation.
+	 * @see buildLods
+	 */
+	void setLodRatios(std::vector<float> ratios) { settings.lod_ratios = std::move(ratios); }
+
+	/**
+	 * Load entity from file. The post-processing steps applied by Assimp
+	 * are selected by @p profile.
+	 */
+	Entity* createEntityFromFile(
+		const std::string& name,
+		const std::string& filename,
+		const ImportProfile& profile = ImportProfile::maxQuality()
+	);
+
+	/**
+	 * Start loading an entity on a background thread and return without
+	 * waiting for it. The cache and thread count settings are captured when
+	 * the load starts. The returned handle must be destroyed before this
+	 * scene loader, because the scene loader owns the Assimp logger.
+	 * @see AsyncLoad
+	 */
+	std::unique_ptr<AsyncLoad> createEntityFromFileAsync(
+		const std::string& name,
+		const std::string& filename,
+		const ImportProfile& profile = ImportProfile::maxQuality()
+	);
+
+	/// Timings of the most recent call to @ref createEntityFromFile()
+	const ImportTimings& timings() const { return last_timings; }
+
+	/**
+	 * Material table shared by all entities loaded by this scene loader,
+	 * including cached entities, such that equal materials are stored once.
+	 */
+	const std::shared_ptr<MaterialTable>& materials() const { return material_table; }
+
+private:
+	/// Load settings, captured by value when a load starts
+	struct Settings {
+		bool cache_enabled;
+		std::size_t thread_count;
+		bool optimize_meshes;
+		std::vector<float> lod_ratios;
+	};
+
+	static Entity* loadEntity(
+		const std::string& name,
+		const std::string& filename,
+		const ImportProfile& profile,
+		const Settings& settings,
+		const std::shared_ptr<MaterialTable>& materials,
+		ImportTimings& timings,
+		AsyncLoad* async
+	);
+
+	Settings settings;
+	std::shared_ptr<MaterialTable> material_table;
+	ImportTimings last_timings;
+};
+
+/**
+ * @brief Handle of an entity load running on a background thread.
+ *
+ * The load reports its current @ref SceneLoader::Stage and the progress
+ * within that stage. Meshes become available as soon as they are converted,
+ * in any order, such that the render thread can upload them incrementally
+ * using @ref takeMeshes() while the remaining meshes are still converting.
+ * Taken meshes are owned by the entity under construction and remain valid
+ * until the entity is taken and deleted, or until the handle is destroyed.
+ *
+ * Destroying the handle cancels the load and waits for the background
+ * thread to finish.
+ */
+class SceneLoader::AsyncLoad
+{
+public:
+	~AsyncLoad();
+
+	AsyncLoad(const AsyncLoad&) = delete;
+	AsyncLoad& operator=(const AsyncLoad&) = delete;
+
+	/// Current stage
+	Stage stage() const { return current_stage; }
+
+	/// Progress within the current stage, in the range [0, 1]
+	float progress() const { return stage_progress; }
+
+	/// Boolean indicating whether the load is done, failed or cancelled
+	bool finished() const;
+
+	/**
+	 * Request cancellation. The load stops at the next stage boundary, or
+	 * before the next mesh conversion, and finishes in the
+	 * @ref Stage::Cancelled stage. Meshes that were already taken remain
+	 * valid until the handle is destroyed.
+	 */
+	void cancel() { cancelled = true; }
+
+	/// Block until the load is finished
+	void wait();
+
+	/**
+	 * Take converted meshes that were not taken yet, in conversion order,
+	 * up to @p byte_budget bytes of vertex and index data. At least one
+	 * mesh is taken if any are available, such that meshes larger than the
+	 * budget still make progress.
+	 * @param byte_budget Upload budget in bytes, for example per frame
+	 * @return Meshes ready for upload
+	 */
+	std::vector<const Mesh*> takeMeshes(std::size_t byte_budget);
+
+	/**
+	 * Take ownership of the loaded entity. The entity is only available
+	 * once the load is in the @ref Stage::Done stage, and can only be
+	 * taken once.
+	 * @return Loaded entity, or nullptr if not available
+	 */
+	Entity* takeEntity();
+
+	/// Timings of the load. Only valid once the load is finished.
+	const ImportTimings& timings() const { return load_timings; }
+
+private:
+	friend class SceneLoader;
+
+	AsyncLoad();
+
+	bool isCancelled() const { return cancelled; }
+	void setStage(Stage stage, float progress = 0.0f);
+	void setProgress(float progress) { stage_progress = progress; }
+	void addMesh(const Mesh* mesh);
+	void keepPartialEntity(Entity* partial);
+	void finish(Entity* entity);
+
+	std::thread thread;
+	mutable std::mutex mutex;
+	std::condition_variable finished_cv;
+	std::atomic<Stage> current_stage;
+	std::atomic<float> stage_progress;
+	std::atomic<bool> cancelled;
+	std::deque<const Mesh*> ready_meshes;
+	Entity* entity;
+	Entity* partial_entity; ///< Entity of a failed load that owns taken meshes
+	ImportTimings load_timings;
 };
 
 #endif
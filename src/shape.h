@@ -10,6 +10,9 @@
 #ifndef CORTEX_SHAPE_H
 #define CORTEX_SHAPE_H
 
+#include "topology.h"
+
+#include <cstddef>
 #include <vector>
 
 /**
@@ -27,18 +30,19 @@ struct Cube
 	 * Appends 24 vertices to @p vertices and appends GL_TRIANGLES indices to
 	 * @p indices.
 	 *
-	 * @tparam VertexType 3D vertex type with a @p .position member assignable
-	 *                    from three floats. An optional @p .normal member is
-	 *                    assigned from three floats when present. An optional
-	 *                    @p .texcoord member is assigned from two floats when
-	 *                    present.
+	 * @tparam VertexBuffer Vertex container, such as @c std::vector or
+	 *                      @ref SplitVertexBuffer, of 3D vertex type with a
+	 *                      @p .position member assignable from three floats. An
+	 *                      optional @p .normal member is assigned from three
+	 *                      floats when present. An optional @p .texcoord member
+	 *                      is assigned from two floats when present.
 	 * @tparam IndexType Integer type suitable for array indices.
 	 *
 	 * @param vertices Vertex buffer output. New vertices are appended.
 	 * @param indices Index buffer output. New indices are appended.
 	 */
-	template<typename VertexType, typename IndexType = unsigned int>
-	void tessellate(std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const;
+	template<typename VertexBuffer, typename IndexType = unsigned int>
+	void tessellate(VertexBuffer& vertices, std::vector<IndexType>& indices) const;
 };
 
 /**
@@ -56,16 +60,163 @@ struct Octahedron
 	 * Appends 24 vertices to @p vertices and appends GL_TRIANGLES indices to
 	 * @p indices.
 	 *
-	 * @tparam VertexType 3D vertex type with a @p .position member assignable
-	 *                    from three floats. An optional @p .normal member is
-	 *                    assigned from three floats when present.
+	 * @tparam VertexBuffer Vertex container, such as @c std::vector or
+	 *                      @ref SplitVertexBuffer, of 3D vertex type with a
+	 *                      @p .position member assignable from three floats. An
+	 *                      optional @p .normal member is assigned from three
+	 *                      floats when present.
 	 * @tparam IndexType Integer type suitable for array indices.
 	 *
 	 * @param vertices Vertex buffer output. New vertices are appended.
 	 * @param indices Index buffer output. New indices are appended.
 	 */
-	template<typename VertexType, typename IndexType = unsigned int>
-	void tessellate(std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const;
+	template<typename VertexBuffer, typename IndexType = unsigned int>
+	void tessellate(VertexBuffer& vertices, std::vector<IndexType>& indices) const;
+};
+
+namespace detail {
+
+/**
+ * @brief Point on the profile curve of a surface of revolution.
+ *
+ * The profile lies in the half plane spanned by the radial direction and the
+ * y-axis. The normal must be normalised.
+ */
+struct profile_point_t {
+	float radius;
+	float y;
+	float normal_radius;
+	float normal_y;
+};
+
+} // namespace detail
+
+/**
+ * @brief Surface of revolution template implementation
+ *
+ * Common base of the parametric shape family. Revolves the profile curve of
+ * @p Shape around the y-axis and computes vertex and index data suitable for
+ * GL_TRIANGLES rendering. Vertices form a regular grid of u_count x v_count
+ * samples where u is the angle around the y-axis and v is the position along
+ * the profile curve. The seam at u = 0 and u = 1 is duplicated such that
+ * texture coordinates are continuous.
+ *
+ * The index data only depends on the sample counts (see @ref topology) and
+ * may therefore be shared between all shapes of this family, and with
+ * @ref BezierSurface, that are tessellated with the same sample counts.
+ *
+ * @tparam Shape Derived shape type providing a
+ *               @c profile(float v, detail::profile_point_t&) @c const member
+ *               function for v in [0, 1].
+ */
+template <typename Shape>
+struct RevolvedShape
+{
+	/**
+	 * @brief Tessellate the shape into a vertex buffer without indices.
+	 *
+	 * Appends @p u_count x @p v_count vertices to @p vertices. Use
+	 * @ref topology to obtain matching index data.
+	 *
+	 * @tparam VertexBuffer Vertex container, such as @c std::vector or
+	 *                      @ref SplitVertexBuffer, of 3D vertex type with a
+	 *                      @p .position member assignable from three floats. An
+	 *                      optional @p .normal member is assigned from three
+	 *                      floats when present. Optional @p .tangent and
+	 *                      @p .bitangent members are assigned from three floats
+	 *                      when present; a four component @p .tangent also
+	 *                      receives a handedness of +1. An optional
+	 *                      @p .texcoord member is assigned from (u, v) when
+	 *                      present. Optional members may use the packed types
+	 *                      in packed.h, which encode on assignment.
+	 *
+	 * @param u_count Number of sample points around the y-axis. Must be >= 3.
+	 * @param v_count Number of sample points along the profile. Must be >= 2.
+	 * @param vertices Vertex buffer output. New vertices are appended.
+	 */
+	template<typename VertexBuffer>
+	void tessellate(std::size_t u_count, std::size_t v_count, VertexBuffer& vertices) const;
+
+	/**
+	 * @brief Tessellate the shape into vertex and index buffers suitable for
+	 *        GL_TRIANGLES rendering.
+	 *
+	 * Appends @p u_count x @p v_count vertices to @p vertices and appends
+	 * GL_TRIANGLES indices to @p indices.
+	 *
+	 * @tparam VertexBuffer See above.
+	 * @tparam IndexType Integer type suitable for array indices.
+	 *
+	 * @param u_count Number of sample points around the y-axis. Must be >= 3.
+	 * @param v_count Number of sample points along the profile. Must be >= 2.
+	 * @param vertices Vertex buffer output. New vertices are appended.
+	 * @param indices Index buffer output. New indices are appended.
+	 */
+	template<typename VertexBuffer, typename IndexType = unsigned int>
+	void tessellate(std::size_t u_count, std::size_t v_count, VertexBuffer& vertices, std::vector<IndexType>& indices) const;
+
+	/**
+	 * @brief Grid topology of the indices produced by @ref tessellate.
+	 *
+	 * @param u_count Number of sample points around the y-axis.
+	 * @param v_count Number of sample points along the profile.
+	 */
+	GridTopology topology(std::size_t u_count, std::size_t v_count) const;
+};
+
+/**
+ * @brief Open cylinder centred at the origin and aligned with the y-axis.
+ */
+struct Cylinder : RevolvedShape<Cylinder>
+{
+	float radius;
+	float height;
+
+	Cylinder(float radius = 1.0f, float height = 2.0f);
+
+	void profile(float v, detail::profile_point_t& point) const;
+};
+
+/**
+ * @brief Open cone centred at the origin with its apex on the positive y-axis.
+ */
+struct Cone : RevolvedShape<Cone>
+{
+	float radius;
+	float height;
+
+	Cone(float radius = 1.0f, float height = 2.0f);
+
+	void profile(float v, detail::profile_point_t& point) const;
+};
+
+/**
+ * @brief Capsule centred at the origin and aligned with the y-axis.
+ *
+ * Consists of a cylinder of height @p height capped by two hemispheres of
+ * radius @p radius. Profile samples are distributed by arc length.
+ */
+struct Capsule : RevolvedShape<Capsule>
+{
+	float radius;
+	float height;
+
+	Capsule(float radius = 0.5f, float height = 1.0f);
+
+	void profile(float v, detail::profile_point_t& point) const;
+};
+
+/**
+ * @brief Torus centred at the origin around the y-axis.
+ */
+struct Torus : RevolvedShape<Torus>
+{
+	float major_radius;
+	float minor_radius;
+
+	Torus(float major_radius = 1.0f, float minor_radius = 0.25f);
+
+	void profile(float v, detail::profile_point_t& point) const;
 };
 
 
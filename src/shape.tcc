@@ -14,9 +14,12 @@
 
 #include "vertex_traits.h"
 
-template <typename VertexType, typename IndexType>
-void Cube::tessellate(std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const
+#include <cmath>
+
+template <typename VertexBuffer, typename IndexType>
+void Cube::tessellate(VertexBuffer& vertices, std::vector<IndexType>& indices) const
 {
+	using VertexType = typename VertexBuffer::value_type;
 	static_assert(std::is_default_constructible<VertexType>::value, "VertexType must be default-constructible");
 	static_assert(std::is_integral<IndexType>::value, "IndexType must be an integer type");
 
@@ -100,9 +103,10 @@ void Cube::tessellate(std::vector<VertexType>& vertices, std::vector<IndexType>&
 	}
 }
 
-template <typename VertexType, typename IndexType>
-void Octahedron::tessellate(std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const
+template <typename VertexBuffer, typename IndexType>
+void Octahedron::tessellate(VertexBuffer& vertices, std::vector<IndexType>& indices) const
 {
+	using VertexType = typename VertexBuffer::value_type;
 	static_assert(std::is_default_constructible<VertexType>::value, "VertexType must be default-constructible");
 	static_assert(std::is_integral<IndexType>::value, "IndexType must be an integer type");
 
@@ -172,4 +176,133 @@ void Octahedron::tessellate(std::vector<VertexType>& vertices, std::vector<Index
 	}
 }
 
+template <typename Shape>
+template <typename VertexBuffer>
+void RevolvedShape<Shape>::tessellate(std::size_t u_count, std::size_t v_count, VertexBuffer& vertices) const
+{
+	using VertexType = typename VertexBuffer::value_type;
+	static_assert(std::is_default_constructible<VertexType>::value, "VertexType must be default-constructible");
+
+	static const float two_pi = 6.28318530717958647692f;
+	const Shape& shape = static_cast<const Shape&>(*this);
+
+	vertices.reserve(vertices.size() + (u_count * v_count));
+	for (std::size_t i = 0; i < u_count; ++i) {
+		float u = i / static_cast<float>(u_count - 1);
+		float sin_theta = std::sin(u * two_pi);
+		float cos_theta = std::cos(u * two_pi);
+
+		for (std::size_t j = 0; j < v_count; ++j) {
+			float v = j / static_cast<float>(v_count - 1);
+
+			detail::profile_point_t p;
+			shape.profile(v, p);
+
+			VertexType vertex{};
+			vertex.position = { p.radius * sin_theta, p.y, p.radius * cos_theta };
+			if constexpr (detail::has_normal<VertexType>::value) {
+				vertex.normal = { p.normal_radius * sin_theta, p.normal_y, p.normal_radius * cos_theta };
+			}
+			if constexpr (detail::has_tangent_handedness<VertexType>::value) {
+				// Handedness is +1 because cross(normal, tangent) = bitangent
+				using M = decltype(vertex.tangent);
+				vertex.tangent = M(cos_theta, 0.0f, -sin_theta, 1.0f);
+			} else if constexpr (detail::has_tangent<VertexType>::value) {
+				// Partial derivative dp/du; along the direction of revolution
+				vertex.tangent = { cos_theta, 0.0f, -sin_theta };
+			}
+			if constexpr (detail::has_bitangent<VertexType>::value) {
+				// Partial derivative dp/dv; along the profile
+				vertex.bitangent = { -p.normal_y * sin_theta, p.normal_radius, -p.normal_y * cos_theta };
+			}
+			if constexpr (detail::has_texcoord<VertexType>::value) {
+				using S = typename decltype(vertex.texcoord)::value_type;
+				vertex.texcoord = { static_cast<S>(u), static_cast<S>(v) };
+			}
+			vertices.push_back(std::move(vertex));
+		}
+	}
+}
+
+template <typename Shape>
+template <typename VertexBuffer, typename IndexType>
+void RevolvedShape<Shape>::tessellate(std::size_t u_count, std::size_t v_count, VertexBuffer& vertices, std::vector<IndexType>& indices) const
+{
+	static_assert(std::is_integral<IndexType>::value, "IndexType must be an integer type");
+
+	std::size_t offset = vertices.size();
+	tessellate(u_count, v_count, vertices);
+	topology(u_count, v_count).tessellate(indices, offset);
+}
+
+template <typename Shape>
+GridTopology RevolvedShape<Shape>::topology(std::size_t u_count, std::size_t v_count) const
+{
+	// Seam is duplicated; see RevolvedShape
+	return GridTopology{ u_count, v_count, false, false };
+}
+
+inline Cylinder::Cylinder(float radius, float height)
+: radius(radius),
+  height(height)
+{
+}
+
+inline void Cylinder::profile(float v, detail::profile_point_t& point) const
+{
+	point = { radius, (v - 0.5f) * height, 1.0f, 0.0f };
+}
+
+inline Cone::Cone(float radius, float height)
+: radius(radius),
+  height(height)
+{
+}
+
+inline void Cone::profile(float v, detail::profile_point_t& point) const
+{
+	float slant = std::sqrt(radius * radius + height * height);
+	point = { radius * (1.0f - v), (v - 0.5f) * height, height / slant, radius / slant };
+}
+
+inline Capsule::Capsule(float radius, float height)
+: radius(radius),
+  height(height)
+{
+}
+
+inline void Capsule::profile(float v, detail::profile_point_t& point) const
+{
+	static const float half_pi = 1.57079632679489661923f;
+
+	// Distribute samples by arc length along bottom hemisphere, cylinder and
+	// top hemisphere
+	float arc = half_pi * radius;
+	float s = v * (arc + height + arc);
+	if (s < arc) {
+		float phi = -half_pi + s / radius;
+		point = { radius * std::cos(phi), -0.5f * height + radius * std::sin(phi), std::cos(phi), std::sin(phi) };
+	} else if (s <= arc + height) {
+		point = { radius, -0.5f * height + (s - arc), 1.0f, 0.0f };
+	} else {
+		float phi = (s - arc - height) / radius;
+		point = { radius * std::cos(phi), 0.5f * height + radius * std::sin(phi), std::cos(phi), std::sin(phi) };
+	}
+}
+
+inline Torus::Torus(float major_radius, float minor_radius)
+: major_radius(major_radius),
+  minor_radius(minor_radius)
+{
+}
+
+inline void Torus::profile(float v, detail::profile_point_t& point) const
+{
+	static const float pi = 3.14159265358979323846f;
+
+	// Tube cross-section starting at the inner equator
+	float phi = 2.0f * pi * v - pi;
+	point = { major_radius + minor_radius * std::cos(phi), minor_radius * std::sin(phi), std::cos(phi), std::sin(phi) };
+}
+
 #endif
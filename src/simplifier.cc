@@ -0,0 +1,659 @@
+/**
+ * @file simplifier.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "simplifier.h"
+#include "indexoptimizer.h"
+#include "mesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+namespace {
+
+enum class VertexKind : unsigned char {
+	Manifold, // Interior vertex; collapses along any edge
+	Border, // Single border; collapses along the border
+	Seam, // Two wedges along a single seam; collapses along the seam
+	Locked, // Anything else; never collapses
+};
+
+/**
+ * Error quadric Q(p) = p^T A p + 2 b^T p + c of area weighted planes, with
+ * symmetric matrix A. The accumulated weight normalizes the error to an
+ * approximate squared distance.
+ */
+struct Quadric {
+	double a00 = 0.0, a11 = 0.0, a22 = 0.0;
+	double a01 = 0.0, a02 = 0.0, a12 = 0.0;
+	double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+	double c = 0.0;
+	double w = 0.0;
+
+	void addPlane(const double n[3], double d, double weight)
+	{
+		a00 += weight * n[0] * n[0];
+		a11 += weight * n[1] * n[1];
+		a22 += weight * n[2] * n[2];
+		a01 += weight * n[0] * n[1];
+		a02 += weight * n[0] * n[2];
+		a12 += weight * n[1] * n[2];
+		b0 += weight * n[0] * d;
+		b1 += weight * n[1] * d;
+		b2 += weight * n[2] * d;
+		c += weight * d * d;
+		w += weight;
+	}
+
+	Quadric& operator+=(const Quadric& other)
+	{
+		a00 += other.a00; a11 += other.a11; a22 += other.a22;
+		a01 += other.a01; a02 += other.a02; a12 += other.a12;
+		b0 += other.b0; b1 += other.b1; b2 += other.b2;
+		c += other.c;
+		w += other.w;
+		return *this;
+	}
+
+	double evaluate(const float p[3]) const
+	{
+		double x = p[0], y = p[1], z = p[2];
+		double error =
+			a00 * x * x + a11 * y * y + a22 * z * z +
+			2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+			2.0 * (b0 * x + b1 * y + b2 * z) +
+			c;
+		return std::max(error, 0.0);
+	}
+};
+
+// Collapse of position vertex "from" onto position vertex "to"
+struct Collapse {
+	unsigned int from;
+	unsigned int to;
+	double error;
+};
+
+struct PositionKey {
+	std::uint32_t bits[3];
+
+	bool operator==(const PositionKey& other) const
+	{
+		return std::memcmp(bits, other.bits, sizeof(bits)) == 0;
+	}
+};
+
+struct PositionKeyHash {
+	std::size_t operator()(const PositionKey& key) const
+	{
+		std::size_t hash = key.bits[0];
+		hash = hash * 0x9e3779b1 ^ key.bits[1];
+		hash = hash * 0x9e3779b1 ^ key.bits[2];
+		return hash;
+	}
+};
+
+// Number of triangles using each undirected edge
+using EdgeCounts = std::unordered_map<std::uint64_t, unsigned int>;
+
+} // namespace
+
+// Weight of border and seam edge quadrics relative to face quadrics
+static constexpr double edge_weight = 10.0;
+
+// Cosine of the maximum rotation of a triangle by a single collapse
+static constexpr double max_rotation_cosine = 0.5;
+
+static std::uint64_t edgeKey(unsigned int a, unsigned int b)
+{
+	if (a > b) {
+		std::swap(a, b);
+	}
+	return (static_cast<std::uint64_t>(a) << 32) | b;
+}
+
+static unsigned int edgeCount(const EdgeCounts& counts, unsigned int a, unsigned int b)
+{
+	auto iter = counts.find(edgeKey(a, b));
+	return iter != counts.end() ? iter->second : 0;
+}
+
+static void cross(const double a[3], const double b[3], double out[3])
+{
+	out[0] = a[1] * b[2] - a[2] * b[1];
+	out[1] = a[2] * b[0] - a[0] * b[2];
+	out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static double dot(const double a[3], const double b[3])
+{
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static void triangleNormal(const float* p0, const float* p1, const float* p2, double n[3])
+{
+	double e1[3] = { double(p1[0]) - p0[0], double(p1[1]) - p0[1], double(p1[2]) - p0[2] };
+	double e2[3] = { double(p2[0]) - p0[0], double(p2[1]) - p0[1], double(p2[2]) - p0[2] };
+	cross(e1, e2, n);
+}
+
+/**
+ * Map every vertex to the first vertex with the same position. Vertices
+ * that share a position but differ in other attributes form seams.
+ */
+static std::vector<unsigned int> weldPositions(const float* positions, std::size_t vertex_count, std::size_t stride)
+{
+	std::vector<unsigned int> remap(vertex_count);
+	std::unordered_map<PositionKey, unsigned int, PositionKeyHash> first;
+
+	first.reserve(vertex_count);
+	for (std::size_t v = 0; v < vertex_count; ++v) {
+		PositionKey key;
+		for (std::size_t c = 0; c < 3; ++c) {
+			// Adding zero turns negative zero into zero
+			float value = positions[v * stride + c] + 0.0f;
+			std::memcpy(&key.bits[c], &value, sizeof(value));
+		}
+		remap[v] = first.emplace(key, static_cast<unsigned int>(v)).first->second;
+	}
+
+	return remap;
+}
+
+static void countEdges(
+	const std::vector<unsigned int>& indices,
+	const std::vector<unsigned int>& remap,
+	EdgeCounts& position_edges,
+	EdgeCounts& attribute_edges
+)
+{
+	position_edges.clear();
+	attribute_edges.clear();
+	position_edges.reserve(indices.size());
+	attribute_edges.reserve(indices.size());
+	for (std::size_t i = 0; i < indices.size(); i += 3) {
+		for (std::size_t k = 0; k < 3; ++k) {
+			unsigned int a = indices[i + k];
+			unsigned int b = indices[i + (k + 1) % 3];
+			++position_edges[edgeKey(remap[a], remap[b])];
+			++attribute_edges[edgeKey(a, b)];
+		}
+	}
+}
+
+static std::vector<VertexKind> classifyVertices(
+	const std::vector<unsigned int>& indices,
+	const std::vector<unsigned int>& remap,
+	const EdgeCounts& position_edges,
+	const EdgeCounts& attribute_edges
+)
+{
+	std::size_t vertex_count = remap.size();
+	std::vector<VertexKind> kind(vertex_count, VertexKind::Locked);
+	std::vector<unsigned int> border_edges(vertex_count, 0);
+	std::vector<unsigned int> seam_edges(vertex_count, 0);
+	std::vector<unsigned int> wedge_count(vertex_count, 0);
+	std::vector<bool> referenced(vertex_count, false);
+	std::vector<bool> non_manifold(vertex_count, false);
+
+	for (auto&& edge : position_edges) {
+		unsigned int a = static_cast<unsigned int>(edge.first >> 32);
+		unsigned int b = static_cast<unsigned int>(edge.first);
+		if (edge.second == 1) {
+			++border_edges[a];
+			++border_edges[b];
+		} else if (edge.second > 2) {
+			non_manifold[a] = true;
+			non_manifold[b] = true;
+		}
+	}
+
+	// Seam edges are shared at the position level but not by the wedges
+	for (auto&& edge : attribute_edges) {
+		unsigned int a = remap[static_cast<unsigned int>(edge.first >> 32)];
+		unsigned int b = remap[static_cast<unsigned int>(edge.first)];
+		if (edge.second == 1 && edgeCount(position_edges, a, b) == 2) {
+			++seam_edges[a];
+			++seam_edges[b];
+		}
+	}
+
+	for (unsigned int index : indices) {
+		if (!referenced[index]) {
+			referenced[index] = true;
+			++wedge_count[remap[index]];
+		}
+	}
+
+	for (std::size_t v = 0; v < vertex_count; ++v) {
+		if (remap[v] != v || non_manifold[v]) {
+			continue;
+		}
+
+		if (wedge_count[v] == 1 && seam_edges[v] == 0) {
+			if (border_edges[v] == 0) {
+				kind[v] = VertexKind::Manifold;
+			} else if (border_edges[v] == 2) {
+				kind[v] = VertexKind::Border;
+			}
+		} else if (wedge_count[v] == 2 && border_edges[v] == 0 && seam_edges[v] == 4) {
+			// Two wedges with two seam edges each
+			kind[v] = VertexKind::Seam;
+		}
+	}
+
+	return kind;
+}
+
+static std::vector<Quadric> computeQuadrics(
+	const std::vector<unsigned int>& indices,
+	const std::vector<unsigned int>& remap,
+	const EdgeCounts& position_edges,
+	const EdgeCounts& attribute_edges,
+	const float* positions,
+	std::size_t stride
+)
+{
+	std::vector<Quadric> quadrics(remap.size());
+
+	for (std::size_t i = 0; i < indices.size(); i += 3) {
+		const float* p[3] = {
+			positions + indices[i + 0] * stride,
+			positions + indices[i + 1] * stride,
+			positions + indices[i + 2] * stride,
+		};
+		double n[3];
+		triangleNormal(p[0], p[1], p[2], n);
+
+		double length = std::sqrt(dot(n, n));
+		if (length == 0.0) {
+			continue;
+		}
+		for (std::size_t c = 0; c < 3; ++c) {
+			n[c] /= length;
+		}
+
+		double p0[3] = { p[0][0], p[0][1], p[0][2] };
+		double d = -dot(n, p0);
+		for (std::size_t k = 0; k < 3; ++k) {
+			quadrics[remap[indices[i + k]]].addPlane(n, d, length * 0.5);
+		}
+
+		// Constrain border and seam edges by the plane through the edge
+		// that is perpendicular to the triangle
+		for (std::size_t k = 0; k < 3; ++k) {
+			unsigned int a = indices[i + k];
+			unsigned int b = indices[i + (k + 1) % 3];
+			unsigned int position_count = edgeCount(position_edges, remap[a], remap[b]);
+			if (position_count != 1 &&
+				!(position_count == 2 && edgeCount(attribute_edges, a, b) == 1)
+			) {
+				continue;
+			}
+
+			const float* pa = p[k];
+			const float* pb = p[(k + 1) % 3];
+			double edge[3] = { double(pb[0]) - pa[0], double(pb[1]) - pa[1], double(pb[2]) - pa[2] };
+			double edge_n[3];
+			cross(edge, n, edge_n);
+
+			double edge_length = std::sqrt(dot(edge_n, edge_n));
+			if (edge_length == 0.0) {
+				continue;
+			}
+			for (std::size_t c = 0; c < 3; ++c) {
+				edge_n[c] /= edge_length;
+			}
+
+			double pa_d[3] = { pa[0], pa[1], pa[2] };
+			double edge_d = -dot(edge_n, pa_d);
+			double weight = dot(edge, edge) * edge_weight;
+			quadrics[remap[a]].addPlane(edge_n, edge_d, weight);
+			quadrics[remap[b]].addPlane(edge_n, edge_d, weight);
+		}
+	}
+
+	return quadrics;
+}
+
+static bool canCollapse(VertexKind from, VertexKind to, bool border, bool seam)
+{
+	switch (from) {
+		case VertexKind::Manifold:
+			return !border && !seam;
+
+		case VertexKind::Border:
+			return border && (to == VertexKind::Border || to == VertexKind::Locked);
+
+		case VertexKind::Seam:
+			return seam && (to == VertexKind::Seam || to == VertexKind::Locked);
+
+		default:
+			return false;
+	}
+}
+
+std::size_t simplifyTriangleList(
+	unsigned int* destination,
+	const unsigned int* indices,
+	std::size_t index_count,
+	const float* positions,
+	std::size_t vertex_count,
+	std::size_t stride,
+	std::size_t target_index_count,
+	float* result_error
+)
+{
+	std::vector<unsigned int> current(indices, indices + index_count / 3 * 3);
+	std::vector<unsigned int> remap = weldPositions(positions, vertex_count, stride);
+	std::vector<unsigned int> wedge(vertex_count);
+	EdgeCounts position_edges;
+	EdgeCounts attribute_edges;
+	double max_error = 0.0;
+
+	// Circular lists of the vertices sharing each position
+	for (std::size_t v = 0; v < vertex_count; ++v) {
+		wedge[v] = v;
+	}
+	for (std::size_t v = 0; v < vertex_count; ++v) {
+		if (remap[v] != v) {
+			wedge[v] = wedge[remap[v]];
+			wedge[remap[v]] = v;
+		}
+	}
+
+	countEdges(current, remap, position_edges, attribute_edges);
+	std::vector<VertexKind> kind = classifyVertices(current, remap, position_edges, attribute_edges);
+	std::vector<Quadric> quadrics = computeQuadrics(current, remap, position_edges, attribute_edges, positions, stride);
+
+	std::vector<unsigned int> adjacency_offsets;
+	std::vector<unsigned int> adjacency;
+	std::vector<Collapse> collapses;
+	std::vector<unsigned int> collapse_target(vertex_count);
+	std::vector<unsigned int> wedge_target;
+	std::vector<bool> locked(vertex_count);
+	bool edges_counted = true;
+
+	// Every pass collapses a set of edges with non-overlapping neighborhoods
+	while (current.size() > target_index_count) {
+		std::size_t triangle_count = current.size() / 3;
+
+		if (!edges_counted) {
+			countEdges(current, remap, position_edges, attribute_edges);
+		}
+
+		// Triangles using each vertex
+		adjacency_offsets.assign(vertex_count + 1, 0);
+		for (unsigned int index : current) {
+			++adjacency_offsets[index + 1];
+		}
+		for (std::size_t v = 0; v < vertex_count; ++v) {
+			adjacency_offsets[v + 1] += adjacency_offsets[v];
+		}
+		adjacency.resize(current.size());
+		{
+			std::vector<unsigned int> fill(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+			for (std::size_t i = 0; i < current.size(); ++i) {
+				adjacency[fill[current[i]]++] = i / 3;
+			}
+		}
+
+		collapses.clear();
+		for (std::size_t i = 0; i < current.size(); i += 3) {
+			for (std::size_t k = 0; k < 3; ++k) {
+				unsigned int a = current[i + k];
+				unsigned int b = current[i + (k + 1) % 3];
+				unsigned int ra = remap[a];
+				unsigned int rb = remap[b];
+
+				// Interior edges are visited twice, in opposite directions
+				if (ra == rb || (ra > rb && kind[ra] != VertexKind::Border && kind[rb] != VertexKind::Border)) {
+					continue;
+				}
+				unsigned int position_count = edgeCount(position_edges, ra, rb);
+				if (position_count > 2 || (ra > rb && position_count != 1)) {
+					continue;
+				}
+				bool border = position_count == 1;
+				bool seam = position_count == 2 && edgeCount(attribute_edges, a, b) == 1;
+
+				// Keep the cheaper direction
+				Collapse collapse{ 0, 0, -1.0 };
+				if (canCollapse(kind[ra], kind[rb], border, seam)) {
+					collapse = { ra, rb, quadrics[ra].evaluate(positions + rb * stride) };
+				}
+				if (canCollapse(kind[rb], kind[ra], border, seam)) {
+					double error = quadrics[rb].evaluate(positions + ra * stride);
+					if (collapse.error < 0.0 || error < collapse.error) {
+						collapse = { rb, ra, error };
+					}
+				}
+				if (collapse.error >= 0.0) {
+					collapses.push_back(collapse);
+				}
+			}
+		}
+		if (collapses.empty()) {
+			break;
+		}
+
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+			if (a.error != b.error) {
+				return a.error < b.error;
+			}
+			return a.from != b.from ? a.from < b.from : a.to < b.to;
+		});
+
+		// Interior collapses remove two triangles each
+		std::size_t collapse_budget = std::max<std::size_t>((triangle_count - target_index_count / 3) / 2, 1);
+		std::size_t collapse_count = 0;
+
+		std::fill(locked.begin(), locked.end(), false);
+		for (std::size_t v = 0; v < vertex_count; ++v) {
+			collapse_target[v] = v;
+		}
+
+		for (const Collapse& collapse : collapses) {
+			if (collapse_count >= collapse_budget) {
+				break;
+			}
+			unsigned int u = collapse.from;
+			unsigned int v = collapse.to;
+			if (locked[u] || locked[v]) {
+				continue;
+			}
+
+			// Every wedge of u moves to the wedge of v on the same side of
+			// any seam, and no triangle may flip
+			bool valid = true;
+			wedge_target.clear();
+			unsigned int w = u;
+			do {
+				unsigned int target = ~0u;
+				for (unsigned int j = adjacency_offsets[w]; valid && j < adjacency_offsets[w + 1]; ++j) {
+					const unsigned int* triangle = &current[adjacency[j] * 3];
+					bool collapsed = false;
+					for (std::size_t k = 0; k < 3; ++k) {
+						if (remap[triangle[k]] == v) {
+							target = triangle[k];
+							collapsed = true;
+						}
+					}
+					if (collapsed) {
+						continue;
+					}
+
+					const float* p[3];
+					for (std::size_t k = 0; k < 3; ++k) {
+						p[k] = positions + triangle[k] * stride;
+					}
+					double n0[3];
+					triangleNormal(p[0], p[1], p[2], n0);
+					for (std::size_t k = 0; k < 3; ++k) {
+						if (triangle[k] == w) {
+							p[k] = positions + v * stride;
+						}
+					}
+					double n1[3];
+					triangleNormal(p[0], p[1], p[2], n1);
+
+					// Reject rotations beyond 60 degrees, which also keeps
+					// repeated collapses from folding triangles over
+					double length = std::sqrt(dot(n0, n0) * dot(n1, n1));
+					if (length > 0.0 && dot(n0, n1) <= length * max_rotation_cosine) {
+						valid = false;
+					} else if (dot(n0, n0) > 0.0 && dot(n1, n1) == 0.0) {
+						valid = false;
+					}
+				}
+
+				if (adjacency_offsets[w] != adjacency_offsets[w + 1]) {
+					if (target == ~0u) {
+						valid = false;
+					}
+					wedge_target.push_back(w);
+					wedge_target.push_back(target);
+				}
+				w = wedge[w];
+			} while (valid && w != u);
+
+			if (!valid) {
+				continue;
+			}
+
+			for (std::size_t i = 0; i < wedge_target.size(); i += 2) {
+				collapse_target[wedge_target[i]] = wedge_target[i + 1];
+			}
+			if (quadrics[u].w > 0.0) {
+				max_error = std::max(max_error, collapse.error / quadrics[u].w);
+			}
+			quadrics[v] += quadrics[u];
+
+			// Lock the neighborhood of u, which includes v
+			w = u;
+			do {
+				for (unsigned int j = adjacency_offsets[w]; j < adjacency_offsets[w + 1]; ++j) {
+					const unsigned int* triangle = &current[adjacency[j] * 3];
+					for (std::size_t k = 0; k < 3; ++k) {
+						locked[remap[triangle[k]]] = true;
+					}
+				}
+				w = wedge[w];
+			} while (w != u);
+
+			++collapse_count;
+		}
+
+		if (!collapse_count) {
+			break;
+		}
+
+		// Apply collapses and drop degenerate triangles
+		std::size_t write = 0;
+		for (std::size_t i = 0; i < current.size(); i += 3) {
+			unsigned int a = collapse_target[current[i + 0]];
+			unsigned int b = collapse_target[current[i + 1]];
+			unsigned int c = collapse_target[current[i + 2]];
+			if (remap[a] == remap[b] || remap[b] == remap[c] || remap[c] == remap[a]) {
+				continue;
+			}
+			current[write++] = a;
+			current[write++] = b;
+			current[write++] = c;
+		}
+		current.resize(write);
+		edges_counted = false;
+	}
+
+	if (result_error) {
+		*result_error = static_cast<float>(std::sqrt(max_error));
+	}
+	std::copy(current.begin(), current.end(), destination);
+
+	return current.size();
+}
+
+bool buildLods(Mesh* mesh, const std::vector<float>& ratios)
+{
+	if (mesh->indexData() != mesh->index_data.data()) {
+		return false;
+	}
+
+	std::vector<unsigned int> indices(mesh->index_data.begin(), mesh->index_data.end());
+	return buildLods(mesh, indices, ratios);
+}
+
+bool buildLods(Mesh* mesh, const std::vector<unsigned int>& indices, const std::vector<float>& ratios)
+{
+	if (mesh->primitive_type != Mesh::PrimitiveType::Triangle ||
+		mesh->vertexData() != mesh->vertex_data.data() ||
+		!mesh->lods.empty()
+	) {
+		return false;
+	}
+
+	std::size_t index_count = indices.size();
+	std::size_t vertex_count = mesh->vertexCount();
+	std::vector<unsigned int> source(indices);
+	std::vector<unsigned int> simplified(index_count);
+	std::vector<unsigned int> levels;
+	std::vector<Mesh::Lod> lods;
+	float error = 0.0f;
+
+	// Simplify into scratch space, such that the index data is sized once
+	lods.push_back({ 0, static_cast<std::uint32_t>(index_count), 0.0f });
+
+	for (float ratio : ratios) {
+		std::size_t target_index_count = static_cast<std::size_t>(index_count / 3 * ratio) * 3;
+		if (target_index_count >= source.size()) {
+			continue;
+		}
+
+		float level_error;
+		std::size_t count = simplifyTriangleList(
+			simplified.data(),
+			source.data(),
+			source.size(),
+			mesh->vertex_data.data(),
+			vertex_count,
+			mesh->stride,
+			target_index_count,
+			&level_error
+		);
+
+		// Simplification is stuck; further levels would not differ
+		if (count > source.size() / 10 * 9) {
+			break;
+		}
+
+		// Errors accumulate because every level is simplified from the
+		// previous level instead of the full detail mesh
+		error += level_error;
+
+		source.resize(count);
+		optimizeVertexCache(source.data(), simplified.data(), count, vertex_count);
+
+		lods.push_back({
+			static_cast<std::uint32_t>(index_count + levels.size()),
+			static_cast<std::uint32_t>(count),
+			error
+		});
+		levels.insert(levels.end(), source.begin(), source.end());
+	}
+
+	mesh->index_data.clear();
+	mesh->index_data.reserve(index_count + levels.size());
+	mesh->index_data.insert(mesh->index_data.end(), indices.begin(), indices.end());
+	mesh->index_data.insert(mesh->index_data.end(), levels.begin(), levels.end());
+	mesh->lods.assign(lods.begin(), lods.end());
+
+	return true;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file simplifier.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_SIMPLIFIER_H
+#define CORTEX_SIMPLIFIER_H
+
+#include <cstddef>
+#include <vector>
+
+// Forward declaration
+class Mesh;
+
+/**
+ * @brief Simplify triangle list using quadric error metrics (Garland and
+ *        Heckbert, 1997) without creating new vertices.
+ *
+ * Edges are collapsed onto one of their existing vertices in order of
+ * increasing quadric error, such that the result refers to the same vertex
+ * buffer. Vertices that share a position but not their attributes form
+ * attribute seams, which are preserved by collapsing their vertices only
+ * along the seam. Borders are likewise only collapsed along the border and
+ * are additionally constrained by edge quadrics. Collapses that would flip
+ * a triangle are rejected, so the result may be larger than requested.
+ *
+ * @param destination Simplified triangle list output of at most
+ *                    @p index_count indices. May be equal to @p indices.
+ * @param indices Triangle list
+ * @param index_count Number of indices. Trailing partial triangles are
+ *                    ignored.
+ * @param positions Vertex positions; the x,y,z floats of vertex @p i are at
+ *                  @p positions + @p i * @p stride
+ * @param vertex_count Number of vertices
+ * @param stride Position stride in floats. Must be >= 3.
+ * @param target_index_count Requested number of indices
+ * @param result_error Optional output of the geometric error of the
+ *                     result, as an approximate distance from the input
+ *                     surface in mesh units
+ * @return Number of indices in @p destination
+ */
+std::size_t simplifyTriangleList(
+	unsigned int* destination,
+	const unsigned int* indices,
+	std::size_t index_count,
+	const float* positions,
+	std::size_t vertex_count,
+	std::size_t stride,
+	std::size_t target_index_count,
+	float* result_error = nullptr
+);
+
+/**
+ * @brief Build level of detail chain of triangle mesh @p mesh using
+ *        @ref simplifyTriangleList.
+ *
+ * Level 0 is the full detail mesh. Every following level is simplified from
+ * the previous level to the next triangle budget in @p ratios, given as
+ * fractions of the full detail triangle count, e.g. 0.5, 0.25 and 0.12.
+ * The indices of every level are optimized for the vertex cache and
+ * stored after level 0 in @ref Mesh::index_data, such that all levels share
+ * the vertex data. Levels that do not reduce the triangle count of the previous level
+ * by at least 10% are omitted.
+ *
+ * @return Boolean indicating whether levels of detail were built. Meshes
+ *         that are not triangle meshes, or that refer to external data, or
+ *         that already have levels of detail, are not simplified.
+ */
+bool buildLods(Mesh* mesh, const std::vector<float>& ratios);
+
+/**
+ * @brief Build level of detail chain of triangle mesh @p mesh from the full
+ *        detail triangle list @p indices, which is kept in scratch space
+ *        instead of @ref Mesh::index_data.
+ *
+ * All levels, including level 0, are computed before they are written to
+ * @ref Mesh::index_data, such that its storage is allocated once.
+ *
+ * @return See above. The index data of @p mesh is replaced.
+ */
+bool buildLods(Mesh* mesh, const std::vector<unsigned int>& indices, const std::vector<float>& ratios);
+
+#endif
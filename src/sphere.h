@@ -35,17 +35,18 @@ struct Sphere
 	 * multiplies the triangle count by 4; @p divisions = 0 produces an
 	 * octahedron (8 triangles).
 	 *
-	 * @tparam VertexType 3D vertex type with a @p .position member assignable
-	 *                    from T. An optional @p .normal member is assigned
-	 *                    from T when present.
+	 * @tparam VertexBuffer Vertex container, such as @c std::vector or
+	 *                      @ref SplitVertexBuffer, of 3D vertex type with a
+	 *                      @p .position member assignable from T. An optional
+	 *                      @p .normal member is assigned from T when present.
 	 * @tparam IndexType Integer type suitable for array indices.
 	 *
 	 * @param divisions Number of subdivision levels. Must be >= 0.
 	 * @param vertices Vertex buffer output. New vertices are appended.
 	 * @param indices Index buffer output. New indices are appended.
 	 */
-	template<typename VertexType, typename IndexType = unsigned int>
-	void tessellate(std::size_t divisions, std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const;
+	template<typename VertexBuffer, typename IndexType = unsigned int>
+	void tessellate(std::size_t divisions, VertexBuffer& vertices, std::vector<IndexType>& indices) const;
 };
 
 
@@ -64,9 +64,10 @@ void subdivide(std::size_t divisions, std::vector<T>& vertices, std::vector<Inde
 } // namespace detail
 
 template <typename T>
-template <typename VertexType, typename IndexType>
-void Sphere<T>::tessellate(std::size_t divisions, std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const
+template <typename VertexBuffer, typename IndexType>
+void Sphere<T>::tessellate(std::size_t divisions, VertexBuffer& vertices, std::vector<IndexType>& indices) const
 {
+	using VertexType = typename VertexBuffer::value_type;
 	static_assert(std::is_default_constructible<VertexType>::value, "VertexType must be default-constructible");
 	static_assert(std::is_integral<IndexType>::value, "IndexType must be an integer type");
 
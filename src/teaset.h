@@ -14,41 +14,107 @@
 
 #include "bezier.h"
 
-#include <list>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 class Teaset
 {
 public:
 	using BezierPatch = BezierSurface<glm::vec3,3,3>;
 
+	/**
+	 * @brief Control point shared between patches.
+	 */
+	struct ControlPoint
+	{
+		float x, y, z;
+	};
+
+	/**
+	 * @brief Zero-based control point indices of a single patch in
+	 *        @ref BezierPatch order.
+	 */
+	struct PatchData
+	{
+		std::uint32_t k[4][4];
+	};
+
+	/**
+	 * @brief Immutable patch table of a teaset.
+	 *
+	 * Patches reference a single array of unique control points, such that
+	 * memory scales with the number of unique control points rather than
+	 * 16 per patch. The built-in tables are parsed from the original
+	 * dataset at compile time and have static storage duration. See
+	 * @ref PatchModel for patch models loaded from files.
+	 */
+	struct Geometry
+	{
+		const ControlPoint* control_points;
+		std::size_t control_point_count;
+		const PatchData* patches;
+		std::size_t patch_count;
+	};
+
 protected:
-	std::list<BezierPatch> patches;
+	const Geometry* geometry;
 
+	Teaset(const Geometry& geometry);
 	virtual ~Teaset();
 
-	void readData(const char* data, bool data_is_ccw);
-
 public:
-	template<typename VertexType, typename IndexType = unsigned int>
-	void tessellate(unsigned int u_count, unsigned int v_count, std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const;
+	/**
+	 * @brief Number of Bezier patches.
+	 */
+	std::size_t size() const { return geometry->patch_count; }
+
+	/**
+	 * @brief Retrieve Bezier patch at @p index.
+	 */
+	BezierPatch patch(std::size_t index) const;
+
+	template<typename VertexBuffer, typename IndexType = unsigned int>
+	void tessellate(unsigned int u_count, unsigned int v_count, VertexBuffer& vertices, std::vector<IndexType>& indices) const;
 };
 
 class Teapot : public Teaset
 {
 public:
 	Teapot();
+
+	/**
+	 * @brief Shared immutable teapot instance.
+	 *
+	 * Initialized on first use. Safe to call concurrently.
+	 */
+	static const Teapot& shared();
 };
 
 class Teacup : public Teaset
 {
 public:
 	Teacup();
+
+	/**
+	 * @brief Shared immutable teacup instance.
+	 *
+	 * Initialized on first use. Safe to call concurrently.
+	 */
+	static const Teacup& shared();
 };
 
 class Teaspoon : public Teaset
 {
 public:
 	Teaspoon();
+
+	/**
+	 * @brief Shared immutable teaspoon instance.
+	 *
+	 * Initialized on first use. Safe to call concurrently.
+	 */
+	static const Teaspoon& shared();
 };
 
 
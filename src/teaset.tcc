@@ -12,11 +12,11 @@
 #ifndef CORTEX_TEASET_TCC
 #define CORTEX_TEASET_TCC
 
-template<typename VertexType, typename IndexType>
-void Teaset::tessellate(unsigned int u_count, unsigned int v_count, std::vector<VertexType>& vertices, std::vector<IndexType>& indices) const
+template<typename VertexBuffer, typename IndexType>
+void Teaset::tessellate(unsigned int u_count, unsigned int v_count, VertexBuffer& vertices, std::vector<IndexType>& indices) const
 {
-	for (auto&& patch : patches) {
-		patch.tessellate(u_count, v_count, vertices, indices);
+	for (std::size_t i = 0; i < size(); ++i) {
+		patch(i).tessellate(u_count, v_count, vertices, indices);
 	}
 }
 
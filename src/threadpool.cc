@@ -0,0 +1,121 @@
+/**
+ * @file threadpool.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "threadpool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(std::size_t thread_count)
+: job(nullptr),
+  job_count(0),
+  generation(0),
+  active(0),
+  stop(false),
+  next_index(0)
+{
+	if (!thread_count) {
+		thread_count = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	threads.reserve(thread_count - 1);
+	for (std::size_t i = 1; i < thread_count; ++i) {
+		threads.emplace_back(&ThreadPool::worker, this);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	job_cv.notify_all();
+
+	for (auto&& thread : threads) {
+		thread.join();
+	}
+}
+
+void ThreadPool::run(const std::function<void(std::size_t)>& func, std::size_t count)
+{
+	try {
+		for (std::size_t i = next_index++; i < count; i = next_index++) {
+			func(i);
+		}
+	} catch (...) {
+		// Keep the first exception and skip the remaining indices
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!error) {
+			error = std::current_exception();
+		}
+		next_index = count;
+	}
+}
+
+void ThreadPool::worker()
+{
+	std::uint64_t seen_generation = 0;
+	std::unique_lock<std::mutex> lock(mutex);
+
+	while (true) {
+		job_cv.wait(lock, [&]() { return stop || generation != seen_generation; });
+		if (stop) {
+			return;
+		}
+		seen_generation = generation;
+
+		// The job may already be complete if this worker woke up late
+		if (!job) {
+			continue;
+		}
+		const std::function<void(std::size_t)>& func = *job;
+		std::size_t count = job_count;
+		++active;
+
+		lock.unlock();
+		run(func, count);
+		lock.lock();
+
+		if (--active == 0) {
+			done_cv.notify_all();
+		}
+	}
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& func)
+{
+	if (threads.empty() || count < 2) {
+		for (std::size_t i = 0; i < count; ++i) {
+			func(i);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		job = &func;
+		job_count = count;
+		next_index = 0;
+		error = nullptr;
+		++generation;
+	}
+	job_cv.notify_all();
+
+	run(func, count);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	done_cv.wait(lock, [&]() { return active == 0; });
+	job = nullptr;
+
+	if (error) {
+		std::exception_ptr e = error;
+		error = nullptr;
+		std::rethrow_exception(e);
+	}
+}
@@ -0,0 +1,80 @@
+/**
+ * @file threadpool.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_THREAD_POOL_H
+#define CORTEX_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed-size pool of worker threads for data parallel loops.
+ *
+ * The calling thread participates in every loop, such that a pool of size
+ * one runs loops on the calling thread only.
+ */
+class ThreadPool
+{
+public:
+	/**
+	 * @brief Create thread pool.
+	 * @param thread_count Total number of threads, including the calling
+	 *                     thread. Zero selects the number of hardware
+	 *                     threads.
+	 */
+	explicit ThreadPool(std::size_t thread_count = 0);
+	virtual ~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/**
+	 * @brief Total number of threads, including the calling thread.
+	 */
+	std::size_t size() const { return threads.size() + 1; }
+
+	/**
+	 * @brief Invoke @p func for every index in [0, @p count) and wait for
+	 *        completion.
+	 *
+	 * Indices are distributed dynamically and may complete in any order.
+	 * Callers that need deterministic results should write to slots
+	 * selected by the index.
+	 *
+	 * If @p func throws, the remaining indices are skipped and the first
+	 * exception is rethrown on the calling thread once all threads have
+	 * stopped using @p func.
+	 */
+	void parallelFor(std::size_t count, const std::function<void(std::size_t)>& func);
+
+private:
+	void worker();
+	void run(const std::function<void(std::size_t)>& func, std::size_t count);
+
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable job_cv;
+	std::condition_variable done_cv;
+	const std::function<void(std::size_t)>* job;
+	std::size_t job_count;
+	std::uint64_t generation;
+	std::size_t active;
+	bool stop;
+	std::atomic<std::size_t> next_index;
+	std::exception_ptr error; ///< First exception thrown by the current job
+};
+
+#endif
@@ -0,0 +1,24 @@
+/**
+ * @file topology.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "topology.h"
+
+std::shared_ptr<const TopologyCache::IndexBuffer> TopologyCache::get(const GridTopology& topology)
+{
+	auto itr = cache.find(topology);
+	if (itr != cache.end()) {
+		return itr->second;
+	}
+
+	auto indices = std::make_shared<IndexBuffer>();
+	topology.tessellate(*indices);
+
+	cache.emplace(topology, indices);
+	return indices;
+}
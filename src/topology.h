@@ -0,0 +1,108 @@
+/**
+ * @file topology.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_TOPOLOGY_H
+#define CORTEX_TOPOLOGY_H
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Grid topology template implementation
+ *
+ * Describes the GL_TRIANGLES index pattern of a regular grid of @p rows x
+ * @p cols vertices stored in row-major order, such that vertex (i, j) has
+ * index (i * @p cols + j). Each grid cell is split into two triangles.
+ *
+ * The index pattern only depends on the grid dimensions and wrap flags and
+ * not on the vertex data. Shapes with equal topology can therefore share the
+ * same index data and differ only by their base vertex.
+ */
+struct GridTopology
+{
+	/** Number of vertex rows */
+	std::size_t rows;
+
+	/** Number of vertex columns */
+	std::size_t cols;
+
+	/** Connect last row to first row instead of duplicating the seam */
+	bool wrap_rows;
+
+	/** Connect last column to first column instead of duplicating the seam */
+	bool wrap_cols;
+
+	/**
+	 * @brief Number of vertices referenced by the topology.
+	 */
+	std::size_t vertexCount() const;
+
+	/**
+	 * @brief Number of GL_TRIANGLES indices produced by the topology.
+	 */
+	std::size_t indexCount() const;
+
+	/**
+	 * @brief Tessellate the grid into an index buffer suitable for
+	 *        GL_TRIANGLES rendering.
+	 *
+	 * @tparam IndexType Integer type suitable for array indices.
+	 *
+	 * @param indices Index buffer output. New indices are appended.
+	 * @param offset Index of the first grid vertex in the vertex buffer.
+	 */
+	template<typename IndexType = unsigned int>
+	void tessellate(std::vector<IndexType>& indices, std::size_t offset = 0) const;
+
+	bool operator<(const GridTopology& other) const;
+	bool operator==(const GridTopology& other) const;
+};
+
+/**
+ * @brief Cache of grid topology index data
+ *
+ * Generates the index data for each unique @ref GridTopology once and hands
+ * out shared, immutable references to it for subsequent requests.
+ */
+class TopologyCache
+{
+public:
+	using IndexBuffer = std::vector<unsigned int>;
+
+private:
+	std::map<GridTopology, std::shared_ptr<const IndexBuffer>> cache;
+
+public:
+	/**
+	 * @brief Retrieve index data for @p topology, generating it if it is not
+	 *        yet cached.
+	 *
+	 * @param topology Grid topology
+	 * @return Shared index data with zero offset. Use a base vertex to draw it
+	 *         for a grid that is not at the start of the vertex buffer.
+	 */
+	std::shared_ptr<const IndexBuffer> get(const GridTopology& topology);
+
+	/**
+	 * @brief Number of unique topologies in the cache.
+	 */
+	std::size_t size() const { return cache.size(); }
+
+	/**
+	 * @brief Release all cached index data that is not referenced elsewhere.
+	 */
+	void clear() { cache.clear(); }
+};
+
+
+#include "topology.tcc"
+
+#endif
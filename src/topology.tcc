@@ -0,0 +1,72 @@
+/**
+ * @file topology.tcc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "topology.h"
+
+#ifndef CORTEX_TOPOLOGY_TCC
+#define CORTEX_TOPOLOGY_TCC
+
+#include <type_traits>
+
+inline std::size_t GridTopology::vertexCount() const
+{
+	return rows * cols;
+}
+
+inline std::size_t GridTopology::indexCount() const
+{
+	std::size_t cell_rows = wrap_rows ? rows : (rows ? rows - 1 : 0);
+	std::size_t cell_cols = wrap_cols ? cols : (cols ? cols - 1 : 0);
+	return cell_rows * cell_cols * 3 * 2;
+}
+
+template <typename IndexType>
+void GridTopology::tessellate(std::vector<IndexType>& indices, std::size_t offset) const
+{
+	static_assert(std::is_integral<IndexType>::value, "IndexType must be an integer type");
+
+	std::size_t cell_rows = wrap_rows ? rows : (rows ? rows - 1 : 0);
+	std::size_t cell_cols = wrap_cols ? cols : (cols ? cols - 1 : 0);
+
+	indices.reserve(indices.size() + indexCount());
+	for (std::size_t i = 0; i < cell_rows; ++i) {
+		std::size_t i1 = (i + 1) % rows;
+		for (std::size_t j = 0; j < cell_cols; ++j) {
+			std::size_t j1 = (j + 1) % cols;
+
+			indices.push_back(static_cast<IndexType>(offset + (i * cols + j)));
+			indices.push_back(static_cast<IndexType>(offset + (i1 * cols + j)));
+			indices.push_back(static_cast<IndexType>(offset + (i * cols + j1)));
+			indices.push_back(static_cast<IndexType>(offset + (i * cols + j1)));
+			indices.push_back(static_cast<IndexType>(offset + (i1 * cols + j)));
+			indices.push_back(static_cast<IndexType>(offset + (i1 * cols + j1)));
+		}
+	}
+}
+
+inline bool GridTopology::operator<(const GridTopology& other) const
+{
+	if (rows != other.rows)
+		return rows < other.rows;
+	if (cols != other.cols)
+		return cols < other.cols;
+	if (wrap_rows != other.wrap_rows)
+		return wrap_rows < other.wrap_rows;
+	return wrap_cols < other.wrap_cols;
+}
+
+inline bool GridTopology::operator==(const GridTopology& other) const
+{
+	return rows == other.rows &&
+		cols == other.cols &&
+		wrap_rows == other.wrap_rows &&
+		wrap_cols == other.wrap_cols;
+}
+
+#endif
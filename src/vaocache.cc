@@ -0,0 +1,75 @@
+/**
+ * @file vaocache.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "vaocache.h"
+
+#include <algorithm>
+#include <tuple>
+
+bool VertexArrayCache::attribute_format_t::operator<(const attribute_format_t& other) const
+{
+	return
+		std::tie(location, size, type, normalized, offset, binding) <
+		std::tie(other.location, other.size, other.type, other.normalized, other.offset, other.binding);
+}
+
+GLuint VertexArrayCache::get(Format format)
+{
+	// Sort by location such that equal formats compare equal
+	std::sort(format.begin(), format.end());
+
+	auto itr = cache.find(format);
+	if (itr != cache.end()) {
+		return itr->second;
+	}
+
+	GLuint vao = 0;
+	glCreateVertexArrays(1, &vao);
+	for (const auto& attribute : format) {
+		glEnableVertexArrayAttrib(vao, attribute.location);
+		glVertexArrayAttribBinding(vao, attribute.location, attribute.binding);
+		glVertexArrayAttribFormat(vao, attribute.location, attribute.size, attribute.type, attribute.normalized, attribute.offset);
+	}
+
+	cache.emplace(std::move(format), vao);
+	return vao;
+}
+
+void VertexArrayCache::bind(GLuint vao, GLuint binding, GLuint vbo, GLsizei stride, GLuint ibo)
+{
+	glVertexArrayVertexBuffer(vao, binding, vbo, 0, stride);
+	glVertexArrayElementBuffer(vao, ibo);
+	glBindVertexArray(vao);
+}
+
+void VertexArrayCache::clear()
+{
+	for (auto& itr : cache) {
+		glDeleteVertexArrays(1, &itr.second);
+	}
+	cache.clear();
+}
+
+GLenum glComponentType(detail::component_type type)
+{
+	switch (type) {
+		case detail::component_type::Byte: return GL_BYTE;
+		case detail::component_type::UnsignedByte: return GL_UNSIGNED_BYTE;
+		case detail::component_type::Short: return GL_SHORT;
+		case detail::component_type::UnsignedShort: return GL_UNSIGNED_SHORT;
+		case detail::component_type::Int: return GL_INT;
+		case detail::component_type::UnsignedInt: return GL_UNSIGNED_INT;
+		case detail::component_type::HalfFloat: return GL_HALF_FLOAT;
+		case detail::component_type::Float: return GL_FLOAT;
+		case detail::component_type::Double: return GL_DOUBLE;
+		case detail::component_type::Int_2_10_10_10_Rev: return GL_INT_2_10_10_10_REV;
+	}
+
+	return GL_FLOAT;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file vaocache.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_VAOCACHE_H
+#define CORTEX_VAOCACHE_H
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include "vertex_buffer.h"
+#include "vertex_traits.h"
+
+/**
+ * @brief Cache of vertex array objects
+ *
+ * A vertex array object captures the vertex attribute formats as well as the
+ * buffer bindings. Meshes that share a vertex layout and the same shader
+ * attribute locations therefore only differ by their buffer bindings. This
+ * cache creates one vertex array object for each unique attribute format and
+ * callers rebind their vertex and element buffers before drawing, for example
+ * using @ref VertexArrayCache::bind().
+ *
+ * The cached vertex array objects are owned by the cache and must be released
+ * using @ref VertexArrayCache::clear() while the GL context is still current.
+ */
+class VertexArrayCache
+{
+public:
+	/**
+	 * @brief Format of a single enabled vertex attribute.
+	 */
+	struct attribute_format_t {
+		GLuint location;
+		GLint size;
+		GLenum type;
+		GLboolean normalized;
+		GLuint offset;
+		GLuint binding;
+
+		bool operator<(const attribute_format_t& other) const;
+	};
+	using Format = std::vector<attribute_format_t>;
+
+private:
+	std::map<Format, GLuint> cache;
+
+public:
+	VertexArrayCache() = default;
+	VertexArrayCache(const VertexArrayCache&) = delete;
+	VertexArrayCache& operator=(const VertexArrayCache&) = delete;
+
+	/**
+	 * @brief Retrieve vertex array object for @p format, creating it if it is
+	 *        not yet cached.
+	 *
+	 * @param format Vertex attribute formats. Order is not significant.
+	 * @return Vertex array object without buffer bindings.
+	 */
+	GLuint get(Format format);
+
+	/**
+	 * @brief Retrieve vertex array object for the compile-time layout of
+	 *        @p VertexType.
+	 *
+	 * Attributes for which @p lookup returns a negative location are not
+	 * enabled.
+	 *
+	 * @tparam VertexType Vertex type described by @ref detail::vertex_layout
+	 * @tparam AttributeLookup Callable returning the GLint location of a
+	 *                         shader attribute name, or -1 if absent.
+	 *
+	 * @param lookup Shader attribute location lookup
+	 * @param binding Vertex buffer binding index used by all attributes
+	 * @return Vertex array object without buffer bindings.
+	 */
+	template<typename VertexType, typename AttributeLookup>
+	GLuint get(AttributeLookup&& lookup, GLuint binding = 0);
+
+	/**
+	 * @brief Retrieve vertex array object for a @ref SplitVertexBuffer with
+	 *        positions and remaining attributes in separate bindings.
+	 *
+	 * @tparam PositionType Position type of the split vertex buffer
+	 * @tparam AttributeType Attribute type of the split vertex buffer
+	 * @tparam AttributeLookup See above.
+	 *
+	 * @param lookup Shader attribute location lookup
+	 * @param position_binding Vertex buffer binding index for positions
+	 * @param attribute_binding Vertex buffer binding index for attributes
+	 * @return Vertex array object without buffer bindings.
+	 */
+	template<typename PositionType, typename AttributeType, typename AttributeLookup>
+	GLuint getSplit(AttributeLookup&& lookup, GLuint position_binding, GLuint attribute_binding);
+
+	/**
+	 * @brief Append attribute formats for the compile-time layout of
+	 *        @p VertexType to @p format.
+	 *
+	 * @tparam VertexType See above.
+	 * @tparam AttributeLookup See above.
+	 *
+	 * @param format Vertex attribute formats output
+	 * @param lookup Shader attribute location lookup
+	 * @param binding Vertex buffer binding index used by all attributes
+	 */
+	template<typename VertexType, typename AttributeLookup>
+	static void appendFormat(Format& format, AttributeLookup&& lookup, GLuint binding);
+
+	/**
+	 * @brief Bind vertex and element buffers to cached vertex array object.
+	 *
+	 * @param vao Vertex array object
+	 * @param binding Vertex buffer binding index
+	 * @param vbo Vertex buffer object
+	 * @param stride Vertex stride in bytes
+	 * @param ibo Element buffer object, or zero for none
+	 */
+	static void bind(GLuint vao, GLuint binding, GLuint vbo, GLsizei stride, GLuint ibo = 0);
+
+	/**
+	 * @brief Number of unique vertex array objects in the cache.
+	 */
+	std::size_t size() const { return cache.size(); }
+
+	/**
+	 * @brief Delete all cached vertex array objects.
+	 */
+	void clear();
+};
+
+/**
+ * @brief Map @ref detail::component_type to GL component type.
+ */
+GLenum glComponentType(detail::component_type type);
+
+#include "vaocache.tcc"
+
+#endif
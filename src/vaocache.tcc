@@ -0,0 +1,57 @@
+/**
+ * @file vaocache.tcc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "vaocache.h"
+
+#ifndef CORTEX_VAOCACHE_TCC
+#define CORTEX_VAOCACHE_TCC
+
+template<typename VertexType, typename AttributeLookup>
+void VertexArrayCache::appendFormat(Format& format, AttributeLookup&& lookup, GLuint binding)
+{
+	using layout = detail::vertex_layout<VertexType>;
+
+	format.reserve(format.size() + layout::attributes.size());
+	for (const auto& attribute : layout::attributes) {
+		GLint location = lookup(attribute.name);
+		if (location < 0) {
+			continue;
+		}
+
+		format.push_back({
+			static_cast<GLuint>(location),
+			static_cast<GLint>(attribute.size),
+			glComponentType(attribute.type),
+			static_cast<GLboolean>(attribute.normalized),
+			static_cast<GLuint>(attribute.offset),
+			binding,
+		});
+	}
+}
+
+template<typename VertexType, typename AttributeLookup>
+GLuint VertexArrayCache::get(AttributeLookup&& lookup, GLuint binding)
+{
+	Format format;
+	appendFormat<VertexType>(format, lookup, binding);
+	return get(std::move(format));
+}
+
+template<typename PositionType, typename AttributeType, typename AttributeLookup>
+GLuint VertexArrayCache::getSplit(AttributeLookup&& lookup, GLuint position_binding, GLuint attribute_binding)
+{
+	using position_vertex_type = typename SplitVertexBuffer<PositionType, AttributeType>::position_vertex_type;
+
+	Format format;
+	appendFormat<position_vertex_type>(format, lookup, position_binding);
+	appendFormat<AttributeType>(format, lookup, attribute_binding);
+	return get(std::move(format));
+}
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * @file vertex_buffer.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_VERTEX_BUFFER_H
+#define CORTEX_VERTEX_BUFFER_H
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "vertex_traits.h"
+
+/**
+ * @brief Vertex buffer that stores positions separately from all other
+ *        vertex attributes.
+ *
+ * Can be passed to the tessellators in place of @c std::vector. Each vertex
+ * appended by @ref push_back() is split into @ref positions and
+ * @ref attributes, such that both streams can be uploaded to separate vertex
+ * buffer bindings. Passes that only need positions, such as depth-only or
+ * shadow passes, can then fetch only @c sizeof(PositionType) bytes per vertex.
+ *
+ * @tparam PositionType Position type, e.g. @c glm::vec3
+ * @tparam AttributeType Standard-layout type with the remaining optional
+ *                       vertex members, e.g. @c .normal and @c .texcoord, but
+ *                       without a @c .position member.
+ *
+ * @par Example
+ * @code
+ * struct attributes_t { glm::vec3 normal; };
+ *
+ * SplitVertexBuffer<glm::vec3, attributes_t> vertices;
+ * std::vector<unsigned int> indices;
+ * teapot.tessellate(8, 8, vertices, indices);
+ * // vertices.positions and vertices.attributes have equal size
+ * @endcode
+ */
+template<typename PositionType, typename AttributeType>
+class SplitVertexBuffer
+{
+	static_assert(!detail::has_position<AttributeType>::value, "AttributeType must not provide a .position member");
+
+public:
+	/// Combined vertex type populated by the tessellators
+	struct value_type : AttributeType
+	{
+		PositionType position;
+	};
+
+	/// Layout of a single element of @ref positions
+	struct position_vertex_type
+	{
+		PositionType position;
+	};
+
+	std::vector<PositionType> positions;
+	std::vector<AttributeType> attributes;
+
+	std::size_t size() const { return positions.size(); }
+	bool empty() const { return positions.empty(); }
+
+	void reserve(std::size_t count)
+	{
+		positions.reserve(count);
+		attributes.reserve(count);
+	}
+
+	void clear()
+	{
+		positions.clear();
+		attributes.clear();
+	}
+
+	void push_back(const value_type& vertex)
+	{
+		positions.push_back(vertex.position);
+		attributes.push_back(static_cast<const AttributeType&>(vertex));
+	}
+};
+
+#endif
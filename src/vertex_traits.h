@@ -10,6 +10,9 @@
 #ifndef CORTEX_VERTEX_TRAITS_H
 #define CORTEX_VERTEX_TRAITS_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 namespace detail {
@@ -37,6 +40,21 @@ template<typename T>
 struct has_value_type<T, std::void_t<typename T::value_type>> : std::true_type {};
 /// @}
 
+/**
+ * @brief Trait detecting whether @p T provides a @c .position data member.
+ *
+ * Vertex types used by tessellators must provide a @c .position member. The
+ * attribute stream of a @ref SplitVertexBuffer does not.
+ *
+ * @tparam T Template type to inspect.
+ * @{
+ */
+template<typename T, typename = void>
+struct has_position : std::false_type {};
+template<typename T>
+struct has_position<T, std::void_t<decltype(std::declval<T&>().position)>> : std::true_type {};
+/// @}
+
 /**
  * @brief Trait detecting whether @p T provides a @c .tangent data member.
  *
@@ -153,6 +171,206 @@ template<typename T>
 struct has_texcoord<T, std::void_t<decltype(std::declval<T&>().texcoord)>> : std::true_type {};
 /// @}
 
+/**
+ * @brief Scalar component type of a vertex attribute.
+ *
+ * Mirrors the component types accepted by @c glVertexAttribFormat() without
+ * depending on GL headers.
+ */
+enum class component_type {
+	Byte,
+	UnsignedByte,
+	Short,
+	UnsignedShort,
+	Int,
+	UnsignedInt,
+	HalfFloat,
+	Float,
+	Double,
+	Int_2_10_10_10_Rev, ///< Four signed components packed into 32 bits
+};
+
+/**
+ * @brief Description of a single vertex attribute within @p VertexType.
+ */
+struct vertex_attribute_t {
+	const char* name; ///< Shader attribute name, e.g. @c v_position
+	std::size_t offset; ///< Byte offset of the member within the vertex
+	std::size_t size; ///< Number of components
+	component_type type; ///< Component type
+	bool normalized; ///< Whether integer components are normalized
+};
+
+/**
+ * @brief Map scalar type @p S to its @ref component_type.
+ */
+template<typename S>
+constexpr component_type make_component_type()
+{
+	if constexpr (std::is_same<S, float>::value)
+		return component_type::Float;
+	else if constexpr (std::is_same<S, double>::value)
+		return component_type::Double;
+	else if constexpr (std::is_same<S, std::int8_t>::value)
+		return component_type::Byte;
+	else if constexpr (std::is_same<S, std::uint8_t>::value)
+		return component_type::UnsignedByte;
+	else if constexpr (std::is_same<S, std::int16_t>::value)
+		return component_type::Short;
+	else if constexpr (std::is_same<S, std::uint16_t>::value)
+		return component_type::UnsignedShort;
+	else if constexpr (std::is_same<S, std::int32_t>::value)
+		return component_type::Int;
+	else if constexpr (std::is_same<S, std::uint32_t>::value)
+		return component_type::UnsignedInt;
+	else
+		static_assert(!sizeof(S), "Unsupported vertex component type");
+}
+
+/**
+ * @brief Trait detecting whether @p T is a packed vertex member type.
+ *
+ * Packed types, such as those in packed.h, describe their GPU representation
+ * using the static members @c packed_type, @c packed_size and
+ * @c packed_normalized. Tessellators assign them from full precision values
+ * and rely on their converting constructors to encode the data.
+ *
+ * @tparam T Template type to inspect.
+ * @{
+ */
+template<typename T, typename = void>
+struct is_packed : std::false_type {};
+template<typename T>
+struct is_packed<T, std::void_t<decltype(T::packed_size)>> : std::true_type {};
+/// @}
+
+/**
+ * @brief Trait providing the number of components, component type and
+ *        normalization of a vertex member type @p T.
+ *
+ * Vector types such as @c glm::vec3 must provide @c value_type and a
+ * @c constexpr @c length(). Arithmetic types are treated as a single
+ * component. Packed types are described by their own static members.
+ * @{
+ */
+template<typename T, typename = void>
+struct member_traits {
+	static_assert(std::is_arithmetic<T>::value, "Unsupported vertex member type");
+	static constexpr std::size_t size = 1;
+	static constexpr component_type type = make_component_type<T>();
+	static constexpr bool normalized = false;
+};
+template<typename T>
+struct member_traits<T, std::void_t<typename T::value_type, decltype(T::length())>> {
+	static constexpr std::size_t size = T::length();
+	static constexpr component_type type = make_component_type<typename T::value_type>();
+	static constexpr bool normalized = false;
+};
+template<typename T>
+struct member_traits<T, std::enable_if_t<is_packed<T>::value>> {
+	static constexpr std::size_t size = T::packed_size;
+	static constexpr component_type type = T::packed_type;
+	static constexpr bool normalized = T::packed_normalized;
+};
+/// @}
+
+/**
+ * @brief Trait detecting whether @p T provides a four component @c .tangent
+ *        data member with the handedness of the tangent frame in w.
+ *
+ * Such vertices omit the @c .bitangent member. Shaders reconstruct it as
+ * @c cross(n, t.xyz) @c * @c t.w, which saves 12 bytes per vertex compared
+ * to a separate @c glm::vec3 bitangent. Tessellators assign the tangent from
+ * four values (x, y, z, handedness) when this trait is true.
+ *
+ * @tparam T Template type to inspect.
+ *
+ * @par Example
+ * @code
+ * struct vertex_t { glm::vec3 position; glm::vec3 normal; glm::vec4 tangent; };
+ *
+ * static_assert(detail::has_tangent_handedness<vertex_t>::value);
+ *
+ * // Conditional assignment:
+ * if constexpr (detail::has_tangent_handedness<T>::value) {
+ *     v.tangent = { tx, ty, tz, 1.0f };
+ * }
+ * @endcode
+ * @{
+ */
+template<typename T, typename = void>
+struct has_tangent_handedness : std::false_type {};
+template<typename T>
+struct has_tangent_handedness<T, std::enable_if_t<has_tangent<T>::value>>
+	: std::bool_constant<member_traits<decltype(T::tangent)>::size == 4> {};
+/// @}
+
+template<typename M>
+constexpr vertex_attribute_t make_vertex_attribute(const char* name, std::size_t offset)
+{
+	using traits = member_traits<M>;
+	return { name, offset, traits::size, traits::type, traits::normalized };
+}
+
+/**
+ * @brief Compile-time layout descriptor of @p VertexType.
+ *
+ * Lists the attributes detected by the @c has_* traits above in declaration
+ * order of the traits (position, normal, tangent, bitangent, texcoord),
+ * together with their offset, component count and component type.
+ *
+ * @tparam VertexType Standard-layout vertex type.
+ *
+ * @par Example
+ * @code
+ * struct vertex_t { glm::vec3 position; glm::vec3 normal; };
+ *
+ * using layout = detail::vertex_layout<vertex_t>;
+ * static_assert(layout::attributes.size() == 2);
+ * static_assert(layout::attributes[1].offset == offsetof(vertex_t, normal));
+ * @endcode
+ */
+template<typename VertexType>
+struct vertex_layout
+{
+	static_assert(std::is_standard_layout<VertexType>::value, "VertexType must be standard-layout");
+
+	static constexpr std::size_t stride = sizeof(VertexType);
+
+	static constexpr std::size_t count =
+		has_position<VertexType>::value +
+		has_normal<VertexType>::value +
+		has_tangent<VertexType>::value +
+		has_bitangent<VertexType>::value +
+		has_texcoord<VertexType>::value;
+
+	static constexpr std::array<vertex_attribute_t, count> build()
+	{
+		std::array<vertex_attribute_t, count> a{};
+		std::size_t i = 0;
+
+		if constexpr (has_position<VertexType>::value) {
+			a[i++] = make_vertex_attribute<decltype(VertexType::position)>("v_position", offsetof(VertexType, position));
+		}
+		if constexpr (has_normal<VertexType>::value) {
+			a[i++] = make_vertex_attribute<decltype(VertexType::normal)>("v_normal", offsetof(VertexType, normal));
+		}
+		if constexpr (has_tangent<VertexType>::value) {
+			a[i++] = make_vertex_attribute<decltype(VertexType::tangent)>("v_tangent", offsetof(VertexType, tangent));
+		}
+		if constexpr (has_bitangent<VertexType>::value) {
+			a[i++] = make_vertex_attribute<decltype(VertexType::bitangent)>("v_bitangent", offsetof(VertexType, bitangent));
+		}
+		if constexpr (has_texcoord<VertexType>::value) {
+			a[i++] = make_vertex_attribute<decltype(VertexType::texcoord)>("v_texcoord", offsetof(VertexType, texcoord));
+		}
+
+		return a;
+	}
+
+	static constexpr std::array<vertex_attribute_t, count> attributes = build();
+};
+
 } // namespace detail
 
 #endif
@@ -0,0 +1,337 @@
+/**
+ * @file vertextransform.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "vertextransform.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define CORTEX_VERTEX_TRANSFORM_SSE
+#include <xmmintrin.h>
+#endif
+
+bool matrixIsIdentity(const float matrix[16])
+{
+	for (std::size_t i = 0; i < 16; ++i) {
+		if (matrix[i] != (i % 5 == 0 ? 1.0f : 0.0f)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void normalMatrix(const float matrix[16], float normal_matrix[9])
+{
+	// Upper 3x3 of row-major 4x4 matrix
+	auto m = [matrix](std::size_t row, std::size_t col) { return matrix[row * 4 + col]; };
+
+	// Cofactor matrix, which is the inverse-transpose scaled by determinant
+	float c[9] = {
+		m(1,1) * m(2,2) - m(1,2) * m(2,1),
+		m(1,2) * m(2,0) - m(1,0) * m(2,2),
+		m(1,0) * m(2,1) - m(1,1) * m(2,0),
+		m(0,2) * m(2,1) - m(0,1) * m(2,2),
+		m(0,0) * m(2,2) - m(0,2) * m(2,0),
+		m(0,1) * m(2,0) - m(0,0) * m(2,1),
+		m(0,1) * m(1,2) - m(0,2) * m(1,1),
+		m(0,2) * m(1,0) - m(0,0) * m(1,2),
+		m(0,0) * m(1,1) - m(0,1) * m(1,0),
+	};
+	float det = m(0,0) * c[0] + m(0,1) * c[1] + m(0,2) * c[2];
+	float scale = det != 0.0f ? 1.0f / det : 1.0f;
+
+	for (std::size_t i = 0; i < 9; ++i) {
+		normal_matrix[i] = c[i] * scale;
+	}
+}
+
+static inline void extendBounds(const float* p, float* bounds_min, float* bounds_max)
+{
+	for (std::size_t c = 0; c < 3; ++c) {
+		bounds_min[c] = std::min(bounds_min[c], p[c]);
+		bounds_max[c] = std::max(bounds_max[c], p[c]);
+	}
+}
+
+static void transformPointsScalar(const float* m, const float* src, std::size_t count, float* dst, std::size_t stride, float* bounds_min, float* bounds_max)
+{
+	for (std::size_t i = 0; i < count; ++i, src += 3, dst += stride) {
+		float x = src[0];
+		float y = src[1];
+		float z = src[2];
+		dst[0] = m[0] * x + m[1] * y + m[2] * z + m[3];
+		dst[1] = m[4] * x + m[5] * y + m[6] * z + m[7];
+		dst[2] = m[8] * x + m[9] * y + m[10] * z + m[11];
+
+		if (bounds_min) {
+			extendBounds(dst, bounds_min, bounds_max);
+		}
+	}
+}
+
+static void copyPointsScalar(const float* src, std::size_t count, float* dst, std::size_t stride, float* bounds_min, float* bounds_max)
+{
+	for (std::size_t i = 0; i < count; ++i, src += 3, dst += stride) {
+		dst[0] = src[0];
+		dst[1] = src[1];
+		dst[2] = src[2];
+		extendBounds(dst, bounds_min, bounds_max);
+	}
+}
+
+static void transformVectorsScalar(const float* m, bool normalize, const float* src, std::size_t count, float* dst, std::size_t stride)
+{
+	for (std::size_t i = 0; i < count; ++i, src += 3, dst += stride) {
+		float x = src[0];
+		float y = src[1];
+		float z = src[2];
+		float tx = m[0] * x + m[1] * y + m[2] * z;
+		float ty = m[3] * x + m[4] * y + m[5] * z;
+		float tz = m[6] * x + m[7] * y + m[8] * z;
+
+		if (normalize) {
+			float length2 = tx * tx + ty * ty + tz * tz;
+			float scale = length2 > 0.0f ? 1.0f / std::sqrt(length2) : 0.0f;
+			tx *= scale;
+			ty *= scale;
+			tz *= scale;
+		}
+
+		dst[0] = tx;
+		dst[1] = ty;
+		dst[2] = tz;
+	}
+}
+
+#ifdef CORTEX_VERTEX_TRANSFORM_SSE
+
+// Load four x,y,z triplets and deinterleave them into x, y and z registers
+static inline void loadSoA(const float* src, __m128& x, __m128& y, __m128& z)
+{
+	__m128 a = _mm_loadu_ps(src); // x0 y0 z0 x1
+	__m128 b = _mm_loadu_ps(src + 4); // y1 z1 x2 y2
+	__m128 c = _mm_loadu_ps(src + 8); // z2 x3 y3 z3
+
+	__m128 bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)); // x2 x2 x3 x3
+	x = _mm_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+
+	__m128 ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)); // y0 y0 y1 y1
+	bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)); // y2 y2 y3 y3
+	y = _mm_shuffle_ps(ab, bc, _MM_SHUFFLE(2, 0, 2, 0));
+
+	ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)); // z0 z0 z1 z1
+	__m128 cc = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)); // z2 z2 z3 z3
+	z = _mm_shuffle_ps(ab, cc, _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+// Interleave x, y and z registers and store four triplets at stride
+static inline void storeAoS(__m128 x, __m128 y, __m128 z, float* dst, std::size_t stride)
+{
+	__m128 w = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+
+	const __m128 rows[4] = { x, y, z, w };
+	for (const __m128& row : rows) {
+		_mm_storel_pi(reinterpret_cast<__m64*>(dst), row);
+		_mm_store_ss(dst + 2, _mm_movehl_ps(row, row));
+		dst += stride;
+	}
+}
+
+// Reduce four lane minimums and maximums per axis and extend bounds by them
+static inline void storeBounds(const __m128 lane_min[3], const __m128 lane_max[3], float* bounds_min, float* bounds_max)
+{
+	for (std::size_t c = 0; c < 3; ++c) {
+		__m128 lo = _mm_min_ps(lane_min[c], _mm_movehl_ps(lane_min[c], lane_min[c]));
+		lo = _mm_min_ss(lo, _mm_shuffle_ps(lo, lo, _MM_SHUFFLE(1, 1, 1, 1)));
+		__m128 hi = _mm_max_ps(lane_max[c], _mm_movehl_ps(lane_max[c], lane_max[c]));
+		hi = _mm_max_ss(hi, _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(1, 1, 1, 1)));
+
+		bounds_min[c] = std::min(bounds_min[c], _mm_cvtss_f32(lo));
+		bounds_max[c] = std::max(bounds_max[c], _mm_cvtss_f32(hi));
+	}
+}
+
+static inline __m128 dot3(__m128 m0, __m128 m1, __m128 m2, __m128 x, __m128 y, __m128 z)
+{
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m1, y)), _mm_mul_ps(m2, z));
+}
+
+void transformPoints(
+	const float matrix[16],
+	const float* src,
+	std::size_t count,
+	float* dst,
+	std::size_t stride,
+	float bounds_min[3],
+	float bounds_max[3]
+)
+{
+	__m128 m[12];
+	for (std::size_t i = 0; i < 12; ++i) {
+		m[i] = _mm_set1_ps(matrix[i]);
+	}
+
+	// Lane bounds are cheaper to track unconditionally than to branch on
+	__m128 lane_min[3];
+	__m128 lane_max[3];
+	for (std::size_t c = 0; c < 3; ++c) {
+		lane_min[c] = _mm_set1_ps(FLT_MAX);
+		lane_max[c] = _mm_set1_ps(-FLT_MAX);
+	}
+
+	std::size_t i = 0;
+	for (; i + 4 <= count; i += 4, src += 12, dst += 4 * stride) {
+		__m128 x, y, z;
+		loadSoA(src, x, y, z);
+
+		__m128 tx = _mm_add_ps(dot3(m[0], m[1], m[2], x, y, z), m[3]);
+		__m128 ty = _mm_add_ps(dot3(m[4], m[5], m[6], x, y, z), m[7]);
+		__m128 tz = _mm_add_ps(dot3(m[8], m[9], m[10], x, y, z), m[11]);
+
+		lane_min[0] = _mm_min_ps(lane_min[0], tx);
+		lane_min[1] = _mm_min_ps(lane_min[1], ty);
+		lane_min[2] = _mm_min_ps(lane_min[2], tz);
+		lane_max[0] = _mm_max_ps(lane_max[0], tx);
+		lane_max[1] = _mm_max_ps(lane_max[1], ty);
+		lane_max[2] = _mm_max_ps(lane_max[2], tz);
+
+		storeAoS(tx, ty, tz, dst, stride);
+	}
+
+	if (bounds_min) {
+		storeBounds(lane_min, lane_max, bounds_min, bounds_max);
+	}
+	transformPointsScalar(matrix, src, count - i, dst, stride, bounds_min, bounds_max);
+}
+
+void copyPoints(const float* src, std::size_t count, float* dst, std::size_t stride, float bounds_min[3], float bounds_max[3])
+{
+	__m128 lane_min[3];
+	__m128 lane_max[3];
+	for (std::size_t c = 0; c < 3; ++c) {
+		lane_min[c] = _mm_set1_ps(FLT_MAX);
+		lane_max[c] = _mm_set1_ps(-FLT_MAX);
+	}
+
+	std::size_t i = 0;
+	for (; i + 4 <= count; i += 4, src += 12, dst += 4 * stride) {
+		__m128 x, y, z;
+		loadSoA(src, x, y, z);
+
+		lane_min[0] = _mm_min_ps(lane_min[0], x);
+		lane_min[1] = _mm_min_ps(lane_min[1], y);
+		lane_min[2] = _mm_min_ps(lane_min[2], z);
+		lane_max[0] = _mm_max_ps(lane_max[0], x);
+		lane_max[1] = _mm_max_ps(lane_max[1], y);
+		lane_max[2] = _mm_max_ps(lane_max[2], z);
+
+		storeAoS(x, y, z, dst, stride);
+	}
+
+	storeBounds(lane_min, lane_max, bounds_min, bounds_max);
+	copyPointsScalar(src, count - i, dst, stride, bounds_min, bounds_max);
+}
+
+void pointBounds(const float* positions, std::size_t count, std::size_t stride, float bounds_min[3], float bounds_max[3])
+{
+	if (!count) {
+		return;
+	}
+
+	// One point per register; the fourth lane is ignored. The z component
+	// is loaded separately to avoid reading beyond the last point.
+	__m128 lo = _mm_setr_ps(bounds_min[0], bounds_min[1], bounds_min[2], 0.0f);
+	__m128 hi = _mm_setr_ps(bounds_max[0], bounds_max[1], bounds_max[2], 0.0f);
+	for (std::size_t i = 0; i < count; ++i, positions += stride) {
+		__m128 xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(positions));
+		__m128 p = _mm_movelh_ps(xy, _mm_load_ss(positions + 2));
+		lo = _mm_min_ps(lo, p);
+		hi = _mm_max_ps(hi, p);
+	}
+
+	float result[4];
+	_mm_storeu_ps(result, lo);
+	bounds_min[0] = result[0];
+	bounds_min[1] = result[1];
+	bounds_min[2] = result[2];
+	_mm_storeu_ps(result, hi);
+	bounds_max[0] = result[0];
+	bounds_max[1] = result[1];
+	bounds_max[2] = result[2];
+}
+
+void transformVectors(const float matrix[9], bool normalize, const float* src, std::size_t count, float* dst, std::size_t stride)
+{
+	__m128 m[9];
+	for (std::size_t i = 0; i < 9; ++i) {
+		m[i] = _mm_set1_ps(matrix[i]);
+	}
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+
+	std::size_t i = 0;
+	for (; i + 4 <= count; i += 4, src += 12, dst += 4 * stride) {
+		__m128 x, y, z;
+		loadSoA(src, x, y, z);
+
+		__m128 tx = dot3(m[0], m[1], m[2], x, y, z);
+		__m128 ty = dot3(m[3], m[4], m[5], x, y, z);
+		__m128 tz = dot3(m[6], m[7], m[8], x, y, z);
+
+		if (normalize) {
+			__m128 length2 = dot3(tx, ty, tz, tx, ty, tz);
+			__m128 scale = _mm_div_ps(one, _mm_sqrt_ps(length2));
+			scale = _mm_and_ps(_mm_cmpgt_ps(length2, zero), scale);
+			tx = _mm_mul_ps(tx, scale);
+			ty = _mm_mul_ps(ty, scale);
+			tz = _mm_mul_ps(tz, scale);
+		}
+
+		storeAoS(tx, ty, tz, dst, stride);
+	}
+
+	transformVectorsScalar(matrix, normalize, src, count - i, dst, stride);
+}
+
+#else
+
+void transformPoints(
+	const float matrix[16],
+	const float* src,
+	std::size_t count,
+	float* dst,
+	std::size_t stride,
+	float bounds_min[3],
+	float bounds_max[3]
+)
+{
+	transformPointsScalar(matrix, src, count, dst, stride, bounds_min, bounds_max);
+}
+
+void copyPoints(const float* src, std::size_t count, float* dst, std::size_t stride, float bounds_min[3], float bounds_max[3])
+{
+	copyPointsScalar(src, count, dst, stride, bounds_min, bounds_max);
+}
+
+void pointBounds(const float* positions, std::size_t count, std::size_t stride, float bounds_min[3], float bounds_max[3])
+{
+	for (std::size_t i = 0; i < count; ++i, positions += stride) {
+		extendBounds(positions, bounds_min, bounds_max);
+	}
+}
+
+void transformVectors(const float matrix[9], bool normalize, const float* src, std::size_t count, float* dst, std::size_t stride)
+{
+	transformVectorsScalar(matrix, normalize, src, count, dst, stride);
+}
+
+#endif
@@ -0,0 +1,108 @@
+/**
+ * @file vertextransform.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_VERTEX_TRANSFORM_H
+#define CORTEX_VERTEX_TRANSFORM_H
+
+#include <cstddef>
+
+/**
+ * @brief Determine whether row-major 4x4 @p matrix is the identity matrix.
+ */
+bool matrixIsIdentity(const float matrix[16]);
+
+/**
+ * @brief Compute the normal matrix of row-major 4x4 affine @p matrix.
+ *
+ * The normal matrix is the inverse-transpose of the upper 3x3 matrix and
+ * keeps normals perpendicular to surfaces under non-uniform scaling. For
+ * singular matrices, the cofactor matrix is used instead, which differs
+ * only by scale.
+ *
+ * @param matrix Row-major 4x4 affine matrix
+ * @param normal_matrix Row-major 3x3 normal matrix output
+ */
+void normalMatrix(const float matrix[16], float normal_matrix[9]);
+
+/**
+ * @brief Transform tightly packed 3D points by row-major 4x4 affine
+ *        @p matrix and write them to interleaved vertex data.
+ *
+ * Processes four points per iteration with SSE where available. The
+ * bounding box of the transformed points is accumulated in the same pass.
+ *
+ * @param matrix Row-major 4x4 affine matrix. The last row is ignored.
+ * @param src Input of @p count x,y,z triplets
+ * @param count Number of points
+ * @param dst Output; point @p i is written to the first three floats at
+ *            @p dst + @p i * @p stride
+ * @param stride Output stride in floats. Must be >= 3.
+ * @param bounds_min Optional bounding box minimum, extended by the output
+ * @param bounds_max Optional bounding box maximum, extended by the output
+ */
+void transformPoints(
+	const float matrix[16],
+	const float* src,
+	std::size_t count,
+	float* dst,
+	std::size_t stride,
+	float bounds_min[3] = nullptr,
+	float bounds_max[3] = nullptr
+);
+
+/**
+ * @brief Copy tightly packed 3D points to interleaved vertex data and
+ *        accumulate their bounding box in the same pass.
+ *
+ * Processes four points per iteration with SSE where available.
+ *
+ * @param src Input of @p count x,y,z triplets
+ * @param count Number of points
+ * @param dst Output; point @p i is written to the first three floats at
+ *            @p dst + @p i * @p stride
+ * @param stride Output stride in floats. Must be >= 3.
+ * @param bounds_min Bounding box minimum, extended by the points
+ * @param bounds_max Bounding box maximum, extended by the points
+ */
+void copyPoints(const float* src, std::size_t count, float* dst, std::size_t stride, float bounds_min[3], float bounds_max[3]);
+
+/**
+ * @brief Accumulate the bounding box of 3D points in interleaved vertex
+ *        data, for vertex data that was not written by @ref transformPoints
+ *        or @ref copyPoints.
+ *
+ * @param positions Vertex positions; the x,y,z floats of point @p i are at
+ *                  @p positions + @p i * @p stride
+ * @param count Number of points
+ * @param stride Position stride in floats. Must be >= 3.
+ * @param bounds_min Bounding box minimum, extended by the points
+ * @param bounds_max Bounding box maximum, extended by the points
+ */
+void pointBounds(const float* positions, std::size_t count, std::size_t stride, float bounds_min[3], float bounds_max[3]);
+
+/**
+ * @brief Transform tightly packed 3D vectors by row-major 3x3 @p matrix,
+ *        optionally normalize them, and write them to interleaved vertex
+ *        data.
+ *
+ * Use the upper 3x3 of the model matrix for tangents and bitangents and
+ * @ref normalMatrix for normals. Processes four vectors per iteration with
+ * SSE where available. Zero length vectors remain zero when normalized.
+ *
+ * @param matrix Row-major 3x3 matrix
+ * @param normalize Boolean indicating whether to normalize the results
+ * @param src Input of @p count x,y,z triplets
+ * @param count Number of vectors
+ * @param dst Output; vector @p i is written to the first three floats at
+ *            @p dst + @p i * @p stride
+ * @param stride Output stride in floats. Must be >= 3.
+ */
+void transformVectors(const float matrix[9], bool normalize, const float* src, std::size_t count, float* dst, std::size_t stride);
+
+#endif
@@ -0,0 +1,125 @@
+/**
+ * @file arena_test.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "arena.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static int destroyed = 0;
+
+struct Counted {
+	int value;
+	explicit Counted(int value) : value(value) {}
+	~Counted() { destroyed = destroyed * 10 + value; }
+};
+
+int main()
+{
+	Arena arena(4096);
+
+	// Alignment
+	for (std::size_t alignment : { 1, 2, 4, 8, 16, 32, 64 }) {
+		arena.allocate(1, 1);
+		void* p = arena.allocate(24, alignment);
+		if (reinterpret_cast<std::uintptr_t>(p) % alignment) {
+			std::fprintf(stderr, "Allocation not aligned to %zu bytes\n", alignment);
+			return 1;
+		}
+	}
+	if (arena.bytesReserved() != 4096) {
+		std::fprintf(stderr, "Small allocations not in a single block\n");
+		return 1;
+	}
+
+	// Large allocations get a dedicated block and do not replace the
+	// current block
+	std::size_t used = arena.bytesUsed();
+	float* large = arena.allocateArray<float>(1024);
+	if (reinterpret_cast<std::uintptr_t>(large) % Arena::block_alignment ||
+		arena.bytesReserved() != 4096 + 4096 ||
+		arena.bytesUsed() != used + 4096
+	) {
+		std::fprintf(stderr, "Invalid large allocation\n");
+		return 1;
+	}
+	arena.allocate(8);
+	if (arena.bytesReserved() != 4096 + 4096) {
+		std::fprintf(stderr, "Current block replaced by large allocation\n");
+		return 1;
+	}
+
+	// Large allocations share a reserved block
+	arena.reserve(3 * 4096);
+	float* first = arena.allocateArray<float>(1024);
+	float* second = arena.allocateArray<float>(1024);
+	if (second != first + 1024 ||
+		arena.bytesReserved() != 4096 + 4096 + 3 * 4096
+	) {
+		std::fprintf(stderr, "Large allocations not in reserved block\n");
+		return 1;
+	}
+
+	// Vectors allocate from the arena
+	used = arena.bytesUsed();
+	ArenaVector<unsigned int> vector{ ArenaAllocator<unsigned int>(&arena) };
+	vector.assign({ 1, 2, 3 });
+	if (vector.data() != reinterpret_cast<unsigned int*>(second + 1024) ||
+		arena.bytesUsed() != used + 3 * sizeof(unsigned int)
+	) {
+		std::fprintf(stderr, "Vector not allocated from arena\n");
+		return 1;
+	}
+
+	// Objects are destroyed in reverse order of creation
+	arena.create<Counted>(1);
+	arena.create<Counted>(2);
+	arena.create<Counted>(3);
+	arena.release();
+	if (destroyed != 321 || arena.bytesUsed() || arena.bytesReserved()) {
+		std::fprintf(stderr, "Invalid release\n");
+		return 1;
+	}
+
+	// Concurrent allocations are distinct
+	const unsigned int thread_count = 4;
+	const unsigned int allocation_count = 1000;
+	std::vector<std::vector<unsigned int*>> results(thread_count);
+	std::vector<std::thread> threads;
+	for (unsigned int t = 0; t < thread_count; ++t) {
+		threads.emplace_back([&arena, &results, t]() {
+			for (unsigned int i = 0; i < allocation_count; ++i) {
+				unsigned int* p = arena.allocateArray<unsigned int>(4);
+				for (unsigned int k = 0; k < 4; ++k) {
+					p[k] = t;
+				}
+				results[t].push_back(p);
+			}
+		});
+	}
+	for (auto&& thread : threads) {
+		thread.join();
+	}
+	for (unsigned int t = 0; t < thread_count; ++t) {
+		for (unsigned int* p : results[t]) {
+			if (p[0] != t || p[3] != t) {
+				std::fprintf(stderr, "Concurrent allocations overlap\n");
+				return 1;
+			}
+		}
+	}
+	if (arena.bytesUsed() != thread_count * allocation_count * 4 * sizeof(unsigned int)) {
+		std::fprintf(stderr, "Invalid number of bytes used\n");
+		return 1;
+	}
+
+	return 0;
+}
@@ -13,6 +13,7 @@
 #include "stb_image.h"
 
 #include <cctype>
+#include <chrono>
 #include <cfloat>
 #include <cmath>
 #include <cstddef>
@@ -30,7 +31,6 @@
 #include <errno.h>
 
 #include <assimp/Importer.hpp>
-#include <assimp/postprocess.h>
 #include <assimp/scene.h>
 
 #include <GL/glew.h>
@@ -44,11 +44,18 @@
 
 #include "gldebug.h"
 #include "glhelpers.h"
+#include "importprofile.h"
+#include "mappedio.h"
+#include "packed.h"
+#include "vaocache.h"
+#include "vertex_buffer.h"
 
 static bool ready = false;
 static int width = 0;
 static int height = 0;
 static bool render_normals = false;
+static bool quantize_positions = false;
+static ImportProfile import_profile = ImportProfile::maxQuality();
 
 // Camera state
 static glm::quat camera_orientation(1.0f, 0.0f, 0.0f, 0.0f);
@@ -90,14 +97,27 @@ struct shader_program_t {
 	bool has_fragdata(const std::string& name) const { return fragdata_location.count(name) > 0; }
 };
 
-struct vertex_t {
-	glm::vec3 position;
+// Vertex attributes other than position
+// Tangent handedness in w; shaders reconstruct the bitangent
+struct vertex_attributes_t {
 	glm::vec3 normal;
-	glm::vec3 tangent;
-	glm::vec3 bitangent;
+	glm::vec4 tangent;
 	glm::vec2 texcoord;
 };
 
+// Same as vertex_attributes_t but with octahedral normal and packed tangent
+struct packed_vertex_attributes_t {
+	OctahedralNormal normal;
+	PackedTangent tangent;
+	glm::vec2 texcoord;
+};
+
+// Positions are stored in a separate stream, either as floats or as unorm16
+// relative to the mesh bounding box. Quantized meshes also pack their
+// remaining attributes, such that a vertex shrinks from 48 to 22 bytes.
+using vertices_t = SplitVertexBuffer<glm::vec3, vertex_attributes_t>;
+using quantized_vertices_t = SplitVertexBuffer<QuantizedPosition, packed_vertex_attributes_t>;
+
 struct material_t {
 	glm::vec3 ambient = glm::vec3(0.2f, 0.2f, 0.2f);
 	glm::vec3 diffuse = glm::vec3(0.8f, 0.8f, 0.8f);
@@ -105,12 +125,11 @@ struct material_t {
 	float shininess = 25.0f;
 };
 
+// Normal lines are drawn from the mesh streams as one instance per vertex
 struct normals_t {
 	GLuint vao = 0;
-
-	GLuint vbo = 0;
-	GLuint vbo_binding = 0;
-	GLsizei vertex_count = 0;
+	GLuint attribute_binding = 2;
+	GLuint position_binding = 3;
 };
 
 struct texture_unit_t {
@@ -123,11 +142,24 @@ struct mesh_t {
 
 	GLuint vbo = 0;
 	GLuint vbo_binding = 0;
+	GLsizei vbo_stride = 0;
+
+	// Separate position stream
+	GLuint position_vbo = 0;
+	GLuint position_binding = 1;
+	GLsizei position_stride = 0;
 	GLsizei vertex_count = 0;
 
 	GLuint ibo = 0;
 	GLsizei index_count = 0;
 
+	// Position dequantization; identity for float positions
+	glm::vec3 position_scale = glm::vec3(1.0f);
+	glm::vec3 position_bias = glm::vec3(0.0f);
+
+	// Normals of quantized meshes are octahedral encoded
+	bool octahedral_normal = false;
+
 	material_t material;
 	std::vector<texture_unit_t> textures;
 	const shader_program_t* shader = nullptr;
@@ -142,9 +174,13 @@ static shader_program_t textured_shader;
 // Scene meshes
 static std::vector<mesh_t> meshes;
 
+// Vertex array objects shared by meshes with the same layout and shader
+static VertexArrayCache vao_cache;
+
 // Helper function declarations
+template<typename PositionType, typename AttributeType>
 static void scene_update_mesh(
-	const std::vector<vertex_t>& vertices,
+	const SplitVertexBuffer<PositionType, AttributeType>& vertices,
 	const std::vector<unsigned int>& indices,
 	mesh_t* mesh
 );
@@ -401,137 +437,153 @@ exit:
 	return r;
 }
 
+template<typename PositionType, typename AttributeType>
+static GLuint scene_get_vao(const shader_program_t* shader, GLuint position_binding, GLuint attribute_binding)
+{
+	return vao_cache.getSplit<PositionType, AttributeType>(
+		[shader](const char* name) -> GLint {
+			return shader->has_attribute(name) ? shader->attribute(name) : -1;
+		},
+		position_binding,
+		attribute_binding
+	);
+}
+
+template<typename PositionType, typename AttributeType>
 static void scene_load_mesh(
-	const std::vector<vertex_t>& vertices,
+	const SplitVertexBuffer<PositionType, AttributeType>& vertices,
 	const std::vector<unsigned int>& indices,
 	const shader_program_t* shader,
 	mesh_t* mesh)
 {
 	// VAO layout:
-	// - VBO #0 for interleaved vertex data
+	// - VBO #1 for position only, such that position-only passes fetch
+	//   sizeof(PositionType) bytes per vertex
+	// - VBO #0 for interleaved remaining vertex data
 	// - IBO for element indexes
-
-	// Create vertex array object and vertex/index buffer objects
-	glCreateVertexArrays(1, &mesh->vao);
+	// The VAO is shared with other meshes of the same layout and shader
+	// attribute locations. Buffers are bound before drawing.
+
+	// Retrieve vertex array object and create vertex/index buffer objects
+	mesh->vao = scene_get_vao<PositionType, AttributeType>(shader, mesh->position_binding, mesh->vbo_binding);
+	mesh->vbo_stride = sizeof(AttributeType);
+	mesh->position_stride = sizeof(PositionType);
+	glCreateBuffers(1, &mesh->position_vbo);
 	glCreateBuffers(1, &mesh->vbo);
 	glCreateBuffers(1, &mesh->ibo);
 
-	// Bind buffer objects to vertex array object
-	glVertexArrayVertexBuffer(mesh->vao, mesh->vbo_binding, mesh->vbo, 0, sizeof(vertex_t));
-	glVertexArrayElementBuffer(mesh->vao, mesh->ibo);
-
-	// Setup format and binding for vertex position
-	GLuint pos_loc = shader->attribute("v_position");
-	glEnableVertexArrayAttrib(mesh->vao, pos_loc);
-	glVertexArrayAttribBinding(mesh->vao, pos_loc, mesh->vbo_binding);
-	glVertexArrayAttribFormat(mesh->vao, pos_loc, 3, GL_FLOAT, GL_FALSE, 0);
-
-	// Setup format and binding for vertex normal
-	if (shader->has_attribute("v_normal")) {
-		GLuint norm_loc = shader->attribute("v_normal");
-		glEnableVertexArrayAttrib(mesh->vao, norm_loc);
-		glVertexArrayAttribBinding(mesh->vao, norm_loc, mesh->vbo_binding);
-		glVertexArrayAttribFormat(mesh->vao, norm_loc, 3, GL_FLOAT, GL_FALSE, offsetof(vertex_t, normal));
-	}
-
-	// Setup format and binding for vertex tangent
-	if (shader->has_attribute("v_tangent")) {
-		GLuint tan_loc = shader->attribute("v_tangent");
-		glEnableVertexArrayAttrib(mesh->vao, tan_loc);
-		glVertexArrayAttribBinding(mesh->vao, tan_loc, mesh->vbo_binding);
-		glVertexArrayAttribFormat(mesh->vao, tan_loc, 3, GL_FLOAT, GL_FALSE, offsetof(vertex_t, tangent));
-	}
-
-	// Setup format and binding for vertex bitangent
-	if (shader->has_attribute("v_bitangent")) {
-		GLuint bitan_loc = shader->attribute("v_bitangent");
-		glEnableVertexArrayAttrib(mesh->vao, bitan_loc);
-		glVertexArrayAttribBinding(mesh->vao, bitan_loc, mesh->vbo_binding);
-		glVertexArrayAttribFormat(mesh->vao, bitan_loc, 3, GL_FLOAT, GL_FALSE, offsetof(vertex_t, bitangent));
-	}
-
-	// Setup format and binding for texture coordinates
-	if (shader->has_attribute("v_texcoord")) {
-		GLuint tc_loc = shader->attribute("v_texcoord");
-		glEnableVertexArrayAttrib(mesh->vao, tc_loc);
-		glVertexArrayAttribBinding(mesh->vao, tc_loc, mesh->vbo_binding);
-		glVertexArrayAttribFormat(mesh->vao, tc_loc, 2, GL_FLOAT, GL_FALSE, offsetof(vertex_t, texcoord));
-	}
-
 	mesh->shader = shader;
 
 	// Load data
 	scene_update_mesh(vertices, indices, mesh);
 }
 
+template<typename PositionType, typename AttributeType>
 static void scene_update_mesh(
-	const std::vector<vertex_t>& vertices,
+	const SplitVertexBuffer<PositionType, AttributeType>& vertices,
 	const std::vector<unsigned int>& indices,
 	mesh_t* mesh)
 {
-	// Update existing vertex buffer object
-	glNamedBufferData(mesh->vbo, vertices.size() * sizeof(vertex_t), vertices.data(), GL_STATIC_DRAW);
+	// Update existing vertex buffer objects
+	glNamedBufferData(mesh->position_vbo, vertices.positions.size() * sizeof(PositionType), vertices.positions.data(), GL_STATIC_DRAW);
+	glNamedBufferData(mesh->vbo, vertices.attributes.size() * sizeof(AttributeType), vertices.attributes.data(), GL_STATIC_DRAW);
 	mesh->vertex_count = vertices.size();
 
 	// Update existing index buffer object
 	glNamedBufferData(mesh->ibo, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
 	mesh->index_count = indices.size();
 
-	printf("%s(); vao=%u; vbo=%u[%zu]; ibo=%u[%zu]\n", __FUNCTION__, mesh->vao, mesh->vbo, vertices.size(), mesh->ibo, indices.size());
+	printf("%s(); vao=%u; vbo=%u,%u[%zu]; ibo=%u[%zu]\n", __FUNCTION__, mesh->vao, mesh->position_vbo, mesh->vbo, vertices.size(), mesh->ibo, indices.size());
+}
+
+static void scene_bind_mesh(const mesh_t* mesh)
+{
+	VertexArrayCache::bind(mesh->vao, mesh->vbo_binding, mesh->vbo, mesh->vbo_stride, mesh->ibo);
+	glVertexArrayVertexBuffer(mesh->vao, mesh->position_binding, mesh->position_vbo, 0, mesh->position_stride);
+}
+
+static float scene_quantize_positions(
+	const vertices_t& vertices,
+	const glm::vec3& aabb_min,
+	const glm::vec3& aabb_max,
+	quantized_vertices_t& quantized_vertices)
+{
+	// Map positions to [0,1] relative to the bounding box. Degenerate axes
+	// use a zero scale and quantize to zero.
+	glm::vec3 extent = aabb_max - aabb_min;
+	glm::vec3 inv_extent(
+		extent.x > 0.0f ? 1.0f / extent.x : 0.0f,
+		extent.y > 0.0f ? 1.0f / extent.y : 0.0f,
+		extent.z > 0.0f ? 1.0f / extent.z : 0.0f
+	);
+
+	float max_error = 0.0f;
+	quantized_vertices.clear();
+	quantized_vertices.reserve(vertices.size());
+	for (const glm::vec3& position : vertices.positions) {
+		QuantizedPosition& qp = quantized_vertices.positions.emplace_back((position - aabb_min) * inv_extent);
+
+		// Measure error of the same dequantization as the shaders
+		glm::vec3 p = aabb_min + extent * qp.unpack<glm::vec3>();
+		glm::vec3 error = glm::abs(p - position);
+		max_error = glm::max(max_error, glm::max(glm::max(error.x, error.y), error.z));
+	}
+
+	// Pack remaining attributes, including the tangent handedness
+	for (const vertex_attributes_t& a : vertices.attributes) {
+		packed_vertex_attributes_t& pa = quantized_vertices.attributes.emplace_back();
+		pa.normal = a.normal;
+		pa.tangent = PackedTangent(a.tangent.x, a.tangent.y, a.tangent.z, a.tangent.w);
+		pa.texcoord = a.texcoord;
+	}
+
+	return max_error;
 }
 
+template<typename PositionType, typename AttributeType>
 static void scene_load_mesh_normals(
-	const std::vector<vertex_t>& vertices,
+	const SplitVertexBuffer<PositionType, AttributeType>& vertices,
 	const shader_program_t* shader,
 	normals_t* normals)
 {
 	// VAO layout:
-	// - VBO #0 for position
+	// - Position stream of the mesh in its own binding (divisor 1)
+	// - Attribute stream of the mesh in its own binding (divisor 1)
 	// - No IBO
+	// Each normal line is an instance of two vertices and the vertex shader
+	// offsets the second vertex along the normal, such that no line buffer
+	// is generated. Buffers are bound before drawing.
 
-	// Create vertex array object and vertex buffer object
-	glCreateVertexArrays(1, &normals->vao);
-	glCreateBuffers(1, &normals->vbo);
-
-	// Bind vertex buffer to vertex array object
-	glVertexArrayVertexBuffer(normals->vao, normals->vbo_binding, normals->vbo, 0, sizeof(glm::vec3));
-
-	// Setup format and attribute binding
-	GLuint pos_loc = shader->attribute("v_position");
-	glEnableVertexArrayAttrib(normals->vao, pos_loc);
-	glVertexArrayAttribBinding(normals->vao, pos_loc, normals->vbo_binding);
-	glVertexArrayAttribFormat(normals->vao, pos_loc, 3, GL_FLOAT, GL_FALSE, 0);
-
-	// Generate vertices representing normal lines
-	using line_type = std::pair<glm::vec3,glm::vec3>;
-	std::vector<line_type> normal_lines;
-	normal_lines.reserve(vertices.size());
-	for (auto&& vertex : vertices) {
-		normal_lines.emplace_back(
-			vertex.position,
-			vertex.position + (glm::normalize(vertex.normal) * 0.3f)
-		);
-	}
+	// Retrieve vertex array object
+	normals->vao = scene_get_vao<PositionType, AttributeType>(shader, normals->position_binding, normals->attribute_binding);
+	glVertexArrayBindingDivisor(normals->vao, normals->position_binding, 1);
+	glVertexArrayBindingDivisor(normals->vao, normals->attribute_binding, 1);
 
-	// Update vertex buffer object
-	glNamedBufferData(normals->vbo, normal_lines.size() * sizeof(line_type), normal_lines.data(), GL_STATIC_DRAW);
-	normals->vertex_count = normal_lines.size() * 2; // two vertices per line
+	printf("%s(); vao=%u; instances=%zu\n", __FUNCTION__, normals->vao, vertices.size());
+}
 
-	printf("%s(); vao=%u; vbo=%u[%zu]\n", __FUNCTION__, normals->vao, normals->vbo, normal_lines.size());
+static void scene_bind_mesh_normals(const mesh_t* mesh)
+{
+	const normals_t* normals = &mesh->normals;
+	VertexArrayCache::bind(normals->vao, normals->attribute_binding, mesh->vbo, mesh->vbo_stride);
+	glVertexArrayVertexBuffer(normals->vao, normals->position_binding, mesh->position_vbo, 0, mesh->position_stride);
 }
 
 static void scene_unload_mesh(mesh_t* mesh)
 {
-	if (mesh->vao) {
-		glDeleteVertexArrays(1, &mesh->vao);
-		mesh->vao = 0;
-	}
+	// Vertex array objects are owned by the VAO cache
+	mesh->vao = 0;
 
 	if (mesh->vbo) {
 		glDeleteBuffers(1, &mesh->vbo);
 		mesh->vbo = 0;
 	}
 
+	if (mesh->position_vbo) {
+		glDeleteBuffers(1, &mesh->position_vbo);
+		mesh->position_vbo = 0;
+	}
+
 	if (mesh->ibo) {
 		glDeleteBuffers(1, &mesh->ibo);
 		mesh->ibo = 0;
@@ -545,15 +597,8 @@ static void scene_unload_mesh(mesh_t* mesh)
 	}
 	mesh->textures.clear();
 
-	if (mesh->normals.vao) {
-		glDeleteVertexArrays(1, &mesh->normals.vao);
-		mesh->normals.vao = 0;
-	}
-
-	if (mesh->normals.vbo) {
-		glDeleteBuffers(1, &mesh->normals.vbo);
-		mesh->normals.vbo = 0;
-	}
+	// Normal lines only reference the mesh buffers
+	mesh->normals.vao = 0;
 }
 
 static void scene_unload_shader_program(shader_program_t* shader_program)
@@ -717,7 +762,8 @@ static void scene_load_node_meshes(
 	std::vector<mesh_t>& meshes,
 	const std::string& asset_dir,
 	glm::vec3& aabb_min,
-	glm::vec3& aabb_max
+	glm::vec3& aabb_max,
+	float& quantization_error
 )
 {
 	// aiMatrix4x4 is row-major but glm::mat4 is column-major
@@ -740,10 +786,13 @@ static void scene_load_node_meshes(
 			continue;
 		}
 
-		std::vector<vertex_t> vertices;
+		vertices_t vertices;
 		std::vector<unsigned int> indices;
+		glm::vec3 mesh_aabb_min(FLT_MAX, FLT_MAX, FLT_MAX);
+		glm::vec3 mesh_aabb_max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
 
-		// Process vertices
+		// Process vertices and accumulate the mesh bounding box in the same
+		// pass, such that the vertices are not scanned again
 		vertices.reserve(ai_mesh->mNumVertices);
 		bool has_normals = ai_mesh->HasNormals();
 		bool has_tangents = ai_mesh->HasTangentsAndBitangents();
@@ -752,12 +801,14 @@ static void scene_load_node_meshes(
 			ai_mesh_vertex_idx < ai_mesh->mNumVertices;
 			++ai_mesh_vertex_idx
 		) {
-			vertex_t& vertex = vertices.emplace_back();
+			vertices_t::value_type vertex{};
 
 			// Transform vertex position in node to object space
 			const aiVector3D& v = ai_mesh->mVertices[ai_mesh_vertex_idx];
 			glm::vec4 v_pos = obj_transform * glm::vec4(v.x, v.y, v.z, 1.0f);
 			vertex.position = glm::vec3(v_pos);
+			mesh_aabb_min = glm::min(mesh_aabb_min, vertex.position);
+			mesh_aabb_max = glm::max(mesh_aabb_max, vertex.position);
 
 			// Transform normal vector in node to object space
 			if (has_normals) {
@@ -765,13 +816,16 @@ static void scene_load_node_meshes(
 				vertex.normal = glm::normalize(normal_transform * glm::vec3(n.x, n.y, n.z));
 			}
 
-			// Transform tangent and bitangent vectors in node to object space
+			// Transform tangent vector in node to object space and store
+			// handedness of the tangent frame instead of the bitangent
 			if (has_tangents) {
 				const aiVector3D& t = ai_mesh->mTangents[ai_mesh_vertex_idx];
-				vertex.tangent = glm::normalize(tangent_transform * glm::vec3(t.x, t.y, t.z));
+				glm::vec3 tangent = glm::normalize(tangent_transform * glm::vec3(t.x, t.y, t.z));
 
 				const aiVector3D& b = ai_mesh->mBitangents[ai_mesh_vertex_idx];
-				vertex.bitangent = glm::normalize(tangent_transform * glm::vec3(b.x, b.y, b.z));
+				glm::vec3 bitangent = tangent_transform * glm::vec3(b.x, b.y, b.z);
+				float handedness = glm::dot(glm::cross(vertex.normal, tangent), bitangent) < 0.0f ? -1.0f : 1.0f;
+				vertex.tangent = glm::vec4(tangent, handedness);
 			}
 
 			// Load texture coordinates
@@ -779,6 +833,8 @@ static void scene_load_node_meshes(
 				const aiVector3D& uv = ai_mesh->mTextureCoords[0][ai_mesh_vertex_idx];
 				vertex.texcoord = glm::vec2(uv.x, uv.y);
 			}
+
+			vertices.push_back(vertex);
 		}
 
 		// Process vertex indices
@@ -790,11 +846,9 @@ static void scene_load_node_meshes(
 			}
 		}
 
-		// Update bounding box
-		for (const vertex_t& v : vertices) {
-			aabb_min = glm::min(aabb_min, v.position);
-			aabb_max = glm::max(aabb_max, v.position);
-		}
+		// Update scene bounding box
+		aabb_min = glm::min(aabb_min, mesh_aabb_min);
+		aabb_max = glm::max(aabb_max, mesh_aabb_max);
 
 		// Process material
 		material_t material;
@@ -871,15 +925,27 @@ static void scene_load_node_meshes(
 		mesh_t& mesh = meshes.emplace_back();
 		mesh.material = material;
 		mesh.textures = std::move(mesh_textures);
-		scene_load_mesh(vertices, indices, selected_shader, &mesh);
-
-		if (has_normals) {
-			scene_load_mesh_normals(vertices, selected_shader, &mesh.normals);
+		if (quantize_positions && !vertices.empty()) {
+			quantized_vertices_t quantized_vertices;
+			float error = scene_quantize_positions(vertices, mesh_aabb_min, mesh_aabb_max, quantized_vertices);
+			quantization_error = glm::max(quantization_error, error);
+			mesh.position_scale = mesh_aabb_max - mesh_aabb_min;
+			mesh.position_bias = mesh_aabb_min;
+			mesh.octahedral_normal = true;
+			scene_load_mesh(quantized_vertices, indices, selected_shader, &mesh);
+			if (has_normals) {
+				scene_load_mesh_normals(quantized_vertices, &simple_shader, &mesh.normals);
+			}
+		} else {
+			scene_load_mesh(vertices, indices, selected_shader, &mesh);
+			if (has_normals) {
+				scene_load_mesh_normals(vertices, &simple_shader, &mesh.normals);
+			}
 		}
 	}
 
 	for (unsigned int i = 0; i < node->mNumChildren; ++i) {
-		scene_load_node_meshes(ai_scene, node->mChildren[i], obj_transform, meshes, asset_dir, aabb_min, aabb_max);
+		scene_load_node_meshes(ai_scene, node->mChildren[i], obj_transform, meshes, asset_dir, aabb_min, aabb_max, quantization_error);
 	}
 }
 
@@ -952,8 +1018,11 @@ int scene_load_resources(const char* filename)
 	std::string asset_dir;
 	Assimp::Importer importer;
 	const aiScene* ai_scene = nullptr;
+	ImportTimings import_timings;
+	std::chrono::steady_clock::time_point import_start;
 	glm::vec3 aabb_min(FLT_MAX, FLT_MAX, FLT_MAX);
 	glm::vec3 aabb_max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	float quantization_error = 0.0f;
 
 	// Load shaders
 	r = scene_load_shader_program(
@@ -986,8 +1055,15 @@ int scene_load_resources(const char* filename)
 		}
 	}
 
-	// Load Assimp scene
-	ai_scene = importer.ReadFile(filename, aiProcessPreset_TargetRealtime_MaxQuality);
+	// Load Assimp scene through memory-mapped files and time each
+	// post-processing step. The importer owns the file system.
+	importer.SetIOHandler(new MappedIOSystem);
+	import_start = std::chrono::steady_clock::now();
+	ai_scene = importer.ReadFile(filename, 0);
+	import_timings.parse_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - import_start).count();
+	if (ai_scene) {
+		ai_scene = import_profile.apply(importer, import_timings);
+	}
 	if (!ai_scene) {
 		fprintf(stderr, "%s: %s\n", filename, importer.GetErrorString());
 		r = -1;
@@ -1000,7 +1076,19 @@ int scene_load_resources(const char* filename)
 	// Assimp's convention.
 	stbi_set_flip_vertically_on_load(1);
 
-	scene_load_node_meshes(ai_scene, ai_scene->mRootNode, glm::mat4(1.0f), meshes, asset_dir, aabb_min, aabb_max);
+	import_start = std::chrono::steady_clock::now();
+	scene_load_node_meshes(ai_scene, ai_scene->mRootNode, glm::mat4(1.0f), meshes, asset_dir, aabb_min, aabb_max, quantization_error);
+	import_timings.convert_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - import_start).count();
+	printf("Import profile %s: %s\n", import_profile.name.c_str(), import_timings.toString().c_str());
+	if (quantize_positions && !meshes.empty()) {
+		glm::vec3 aabb_extent = aabb_max - aabb_min;
+		printf("Position quantization: %zu instead of %zu bytes per vertex; max error %g (%g%% of scene extent)\n",
+			sizeof(QuantizedPosition) + sizeof(packed_vertex_attributes_t),
+			sizeof(glm::vec3) + sizeof(vertex_attributes_t),
+			quantization_error,
+			quantization_error * 100.0f / glm::max(glm::max(aabb_extent.x, aabb_extent.y), aabb_extent.z)
+		);
+	}
 
 	if (ai_scene->mNumLights > 0) {
 		const aiLight* light = ai_scene->mLights[0];
@@ -1044,10 +1132,26 @@ void scene_unload_resources(void)
 		scene_unload_mesh(&mesh);
 	}
 	meshes.clear();
+	vao_cache.clear();
 	scene_unload_shader_program(&simple_shader);
 	scene_unload_shader_program(&textured_shader);
 }
 
+void scene_set_position_quantization(bool enabled)
+{
+	quantize_positions = enabled;
+}
+
+int scene_set_import_profile(const char* name)
+{
+	if (!ImportProfile::fromName(name, import_profile)) {
+		fprintf(stderr, "Unknown import profile '%s'\n", name);
+		return -1;
+	}
+
+	return 0;
+}
+
 void scene_resize(int _width, int _height)
 {
 	printf("%s(); width=%d; height=%d\n", __FUNCTION__, _width, _height);
@@ -1107,6 +1211,11 @@ void scene_render(void)
 			glProgramUniform1f(shader->program, shader->uniform("material.shininess"), material->shininess);
 		}
 
+		// Uniform position dequantization
+		glProgramUniform3fv(shader->program, shader->uniform("position_scale"), 1, glm::value_ptr(mesh.position_scale));
+		glProgramUniform3fv(shader->program, shader->uniform("position_bias"), 1, glm::value_ptr(mesh.position_bias));
+		glProgramUniform1i(shader->program, shader->uniform("octahedral_normal"), mesh.octahedral_normal);
+
 		// Bind textures
 		for (const auto& t : mesh.textures) {
 			glBindTextureUnit(t.unit, t.texture);
@@ -1114,7 +1223,7 @@ void scene_render(void)
 
 		// Render mesh
 		glUseProgram(shader->program);
-		glBindVertexArray(mesh.vao);
+		scene_bind_mesh(&mesh);
 		glDrawElements(GL_TRIANGLES, mesh.index_count, GL_UNSIGNED_INT, 0);
 	}
 
@@ -1131,14 +1240,19 @@ void scene_render(void)
 		glProgramUniform3fv(normal_shader->program, normal_shader->uniform("material.ambient"), 1, glm::value_ptr(normals_color));
 		glProgramUniform3fv(normal_shader->program, normal_shader->uniform("material.diffuse"), 1, glm::value_ptr(normals_color));
 
-		// Render normal lines
+		// Render normal lines as one instance of two vertices per mesh vertex
+		glProgramUniform1f(normal_shader->program, normal_shader->uniform("normal_length"), 0.3f);
 		glUseProgram(normal_shader->program);
-		for (mesh_t& mesh : meshes) {
+		for (const mesh_t& mesh : meshes) {
 			if (mesh.normals.vao) {
-				glBindVertexArray(mesh.normals.vao);
-				glDrawArrays(GL_LINES, 0, mesh.normals.vertex_count);
+				glProgramUniform3fv(normal_shader->program, normal_shader->uniform("position_scale"), 1, glm::value_ptr(mesh.position_scale));
+				glProgramUniform3fv(normal_shader->program, normal_shader->uniform("position_bias"), 1, glm::value_ptr(mesh.position_bias));
+				glProgramUniform1i(normal_shader->program, normal_shader->uniform("octahedral_normal"), mesh.octahedral_normal);
+				scene_bind_mesh_normals(&mesh);
+				glDrawArraysInstanced(GL_LINES, 0, 2, mesh.vertex_count);
 			}
 		}
+		glProgramUniform1f(normal_shader->program, normal_shader->uniform("normal_length"), 0.0f);
 	}
 
 	// Cleanup
@@ -17,6 +17,10 @@ __BEGIN_DECLS
 
 int scene_init(void);
 
+void scene_set_position_quantization(bool enabled);
+
+int scene_set_import_profile(const char* name);
+
 int scene_load_resources(const char* filename);
 
 void scene_unload_resources(void);
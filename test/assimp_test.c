@@ -9,6 +9,7 @@
 
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <GLFW/glfw3.h>
 
@@ -106,8 +107,23 @@ int main(int argc, char** argv)
 {
 	printf("GLFW: %s\n", glfwGetVersionString());
 
-	if (argc != 2) {
-		fprintf(stderr, "Usage: %s <model_file>\n", argv[0]);
+	const char* filename = NULL;
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "--quantize") == 0) {
+			scene_set_position_quantization(true);
+		} else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+			if (scene_set_import_profile(argv[++i])) {
+				return 1;
+			}
+		} else if (!filename && argv[i][0] != '-') {
+			filename = argv[i];
+		} else {
+			filename = NULL;
+			break;
+		}
+	}
+	if (!filename) {
+		fprintf(stderr, "Usage: %s [--quantize] [--profile fast|balanced|max-quality] <model_file>\n", argv[0]);
 		return 1;
 	}
 
@@ -152,7 +168,7 @@ int main(int argc, char** argv)
 	if (r) {
 		goto exit3;
 	}
-	r = scene_load_resources(argv[1]);
+	r = scene_load_resources(filename);
 	if (r) {
 		goto exit3;
 	}
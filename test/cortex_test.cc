@@ -11,22 +11,35 @@
 #include "entity.h"
 
 #include <cstdio>
+#include <cstring>
 
 int main(int argc, char** argv)
 {
-	if (argc != 2) {
-		std::fprintf(stderr, "No import file specified\n");
+	ImportProfile profile = ImportProfile::maxQuality();
+	const char* filename;
+
+	if (argc == 2) {
+		filename = argv[1];
+	} else if (argc == 4 && std::strcmp(argv[1], "--profile") == 0) {
+		if (!ImportProfile::fromName(argv[2], profile)) {
+			std::fprintf(stderr, "Unknown import profile '%s'\n", argv[2]);
+			return 1;
+		}
+		filename = argv[3];
+	} else {
+		std::fprintf(stderr, "Usage: %s [--profile fast|balanced|max-quality] <import_file>\n", argv[0]);
 		return 1;
 	}
 
 	SceneLoader loader;
 	Entity* entity;
 
-	entity = loader.createEntityFromFile("test", argv[1]);
+	entity = loader.createEntityFromFile("test", filename, profile);
 	if (!entity) {
-		std::fprintf(stderr, "Failed to import '%s'", argv[1]);
+		std::fprintf(stderr, "Failed to import '%s'", filename);
 		return 1;
 	}
+	std::printf("Import profile %s: %s\n", profile.name.c_str(), loader.timings().toString().c_str());
 
 	delete entity;
 
@@ -9,6 +9,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <GLFW/glfw3.h>
 
@@ -20,6 +21,7 @@ static bool render_normals = false;
 static bool render_wireframe = false;
 static int subdivision_delta = 0;
 static bool is_fullscreen = false;
+static bool benchmark = false;
 static int windowed_x;
 static int windowed_y;
 static int windowed_width;
@@ -87,6 +89,16 @@ int main(int argc, char** argv)
 {
 	printf("GLFW: %s\n", glfwGetVersionString());
 
+	if (argc > 1) {
+		if (argc == 2 && strcmp(argv[1], "--benchmark") == 0) {
+			benchmark = true;
+			current_scene_demo = SCENE_DEMO_INSTANCED;
+		} else {
+			fprintf(stderr, "Usage: %s [--benchmark]\n", argv[0]);
+			return 1;
+		}
+	}
+
 	glfwSetErrorCallback(glfw_error_func);
 
 	int r;
@@ -117,6 +129,10 @@ int main(int argc, char** argv)
 	glfwSetKeyCallback(window, glfw_key_func);
 
 	glfwMakeContextCurrent(window);
+	if (benchmark) {
+		// Render as fast as possible
+		glfwSwapInterval(0);
+	}
 
 	int width, height;
 	glfwGetFramebufferSize(window, &width, &height);
@@ -128,6 +144,7 @@ int main(int argc, char** argv)
 	if (r)
 		goto exit3;
 	scene_resize(width, height);
+	scene_set_benchmark(benchmark);
 
 	while (!glfwWindowShouldClose(window))
 	{
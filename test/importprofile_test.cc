@@ -0,0 +1,81 @@
+/**
+ * @file importprofile_test.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "importprofile.h"
+
+#include <assimp/postprocess.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static bool validate_steps(const ImportProfile& profile, const std::vector<const char*>& names)
+{
+	std::vector<ImportProfile::Step> steps = profile.steps();
+	unsigned int flags = 0;
+
+	if (steps.size() != names.size()) {
+		std::fprintf(stderr, "Profile %s has %zu steps instead of %zu\n", profile.name.c_str(), steps.size(), names.size());
+		return false;
+	}
+	for (std::size_t i = 0; i < steps.size(); ++i) {
+		if (std::strcmp(steps[i].name, names[i]) != 0) {
+			std::fprintf(stderr, "Profile %s step %zu is %s instead of %s\n", profile.name.c_str(), i, steps[i].name, names[i]);
+			return false;
+		}
+		flags |= steps[i].flags;
+	}
+
+	// Together the steps apply exactly the profile flags
+	if (flags != profile.flags) {
+		std::fprintf(stderr, "Profile %s steps apply flags %x instead of %x\n", profile.name.c_str(), flags, profile.flags);
+		return false;
+	}
+
+	return true;
+}
+
+int main()
+{
+	if (!validate_steps(ImportProfile::fast(), { "Triangulate", "SortByPType", "GenNormals", "JoinIdenticalVertices" })) {
+		return 1;
+	}
+
+	if (!validate_steps(ImportProfile::maxQuality(), {
+		"ValidateDataStructure", "RemoveRedundantMaterials", "FindInstances",
+		"GenUVCoords", "Triangulate", "FindDegenerates", "SortByPType",
+		"FindInvalidData", "OptimizeMeshes", "GenSmoothNormals",
+		"CalcTangentSpace", "JoinIdenticalVertices", "SplitLargeMeshes",
+		"LimitBoneWeights", "ImproveCacheLocality",
+	})) {
+		return 1;
+	}
+
+	// Modifiers are applied with every step
+	ImportProfile custom = ImportProfile::custom(aiProcess_GenSmoothNormals | aiProcess_ForceGenNormals | aiProcess_Triangulate);
+	std::vector<ImportProfile::Step> steps = custom.steps();
+	if (steps.size() != 2 ||
+		steps[0].flags != (aiProcess_Triangulate | aiProcess_ForceGenNormals) ||
+		steps[1].flags != (aiProcess_GenSmoothNormals | aiProcess_ForceGenNormals)
+	) {
+		std::fprintf(stderr, "Invalid custom profile steps\n");
+		return 1;
+	}
+
+	// Timings name every step
+	ImportTimings timings;
+	timings.steps.push_back({ "Triangulate", 0.0021 });
+	if (timings.toString().find("(Triangulate 2.10 ms)") == std::string::npos) {
+		std::fprintf(stderr, "Step not named in timings: %s\n", timings.toString().c_str());
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file indexoptimizer_test.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "indexoptimizer.h"
+#include "mesh.h"
+#include "testmesh.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+struct vertex_t {
+	std::array<float, 3> position;
+	float id;
+};
+
+static const unsigned int grid_size = 48;
+
+// Geometry with shuffled triangles and one unreferenced vertex
+static void create_mesh(const TestGeometry& geometry, std::vector<vertex_t>& vertices, std::vector<unsigned int>& indices)
+{
+	std::vector<std::array<unsigned int, 3>> triangles = geometry.triangles;
+
+	for (auto&& p : geometry.positions) {
+		vertices.push_back({ p, float(vertices.size()) });
+	}
+	vertices.push_back({ { -1.0f, -1.0f, -1.0f }, float(vertices.size()) });
+
+	std::srand(1);
+	for (std::size_t i = triangles.size() - 1; i > 0; --i) {
+		std::swap(triangles[i], triangles[std::rand() % (i + 1)]);
+	}
+	for (auto&& triangle : triangles) {
+		indices.insert(indices.end(), triangle.begin(), triangle.end());
+	}
+}
+
+// Triangles by original vertex identity, for order independent comparison
+static std::vector<std::array<float, 3>> triangle_ids(const std::vector<vertex_t>& vertices, const std::vector<unsigned int>& indices)
+{
+	std::vector<std::array<float, 3>> triangles;
+	for (std::size_t i = 0; i < indices.size(); i += 3) {
+		triangles.push_back({ vertices[indices[i]].id, vertices[indices[i + 1]].id, vertices[indices[i + 2]].id });
+	}
+	std::sort(triangles.begin(), triangles.end());
+	return triangles;
+}
+
+static bool validate(const char* name, const TestGeometry& geometry)
+{
+	std::vector<vertex_t> vertices;
+	std::vector<unsigned int> indices;
+	VertexCacheStatistics before;
+	VertexCacheStatistics after;
+
+	create_mesh(geometry, vertices, indices);
+	auto expected_triangles = triangle_ids(vertices, indices);
+
+	optimizeMesh(vertices, indices, &before, &after);
+	std::printf("%s: ACMR %.3f -> %.3f; ATVR %.3f -> %.3f\n", name, before.acmr(), after.acmr(), before.atvr(), after.atvr());
+
+	if (triangle_ids(vertices, indices) != expected_triangles) {
+		std::fprintf(stderr, "Optimized triangles differ from original triangles\n");
+		return false;
+	}
+
+	if (vertices.size() != geometry.positions.size()) {
+		std::fprintf(stderr, "Unreferenced vertex was not removed\n");
+		return false;
+	}
+
+	// Vertices must be in order of first use
+	for (std::size_t i = 0, next = 0; i < indices.size(); ++i) {
+		if (indices[i] > next) {
+			std::fprintf(stderr, "Vertices are not in order of first use\n");
+			return false;
+		}
+		if (indices[i] == next) {
+			++next;
+		}
+	}
+
+	if (before.triangle_count != after.triangle_count ||
+		after.acmr() >= before.acmr() * 0.5f ||
+		after.atvr() > 1.5f
+	) {
+		std::fprintf(stderr, "Insufficient vertex cache improvement\n");
+		return false;
+	}
+
+	return true;
+}
+
+int main()
+{
+	// Open grid with borders, and closed sphere with pole fans where
+	// vertices are shared by many triangles
+	if (!validate("grid", createGrid(grid_size)) ||
+		!validate("sphere", createSphere(32, 64))
+	) {
+		return 1;
+	}
+
+	// Mesh overload must reorder interleaved vertex data the same way
+	Mesh mesh(Mesh::PrimitiveType::Triangle, 3, true);
+	mesh.vertex_data = {
+		0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+		1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+		0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+	};
+	mesh.index_data = { 2, 0, 1 };
+	if (!optimizeMesh(&mesh) ||
+		mesh.index_data != ArenaVector<unsigned int>({ 0, 1, 2 }) ||
+		mesh.vertex_data[1] != 1.0f || mesh.vertex_data[6] != 0.0f || mesh.vertex_data[12] != 1.0f
+	) {
+		std::fprintf(stderr, "Mesh optimization mismatch\n");
+		return 1;
+	}
+
+	Mesh lines(Mesh::PrimitiveType::Line, 2);
+	if (optimizeMesh(&lines)) {
+		std::fprintf(stderr, "Line meshes must not be optimized\n");
+		return 1;
+	}
+
+	return 0;
+}
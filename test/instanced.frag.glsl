@@ -0,0 +1,55 @@
+/**
+ * @file instanced.frag.glsl
+ *
+ * Copyright 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#version 460 core
+
+struct light_t {
+	vec4 position;
+	vec3 ambient;
+	vec3 diffuse;
+	vec3 specular;
+};
+uniform light_t light;
+
+struct material_t {
+	vec3 specular;
+	float shininess;
+};
+uniform material_t material;
+
+in vec3 f_n;
+in vec3 f_l;
+in vec3 f_v;
+in vec4 f_color;
+
+out vec4 color;
+
+void main()
+{
+	// normalize eye space vectors
+	vec3 n = normalize(f_n);
+	vec3 l = normalize(f_l);
+	vec3 v = normalize(f_v);
+
+	// compute ambient and diffuse lighting using per-instance colour
+	float diffuse_intensity = max(dot(n, l), 0.0);
+	vec3 ambient = light.ambient * f_color.rgb * 0.25;
+	vec3 diffuse = light.diffuse * f_color.rgb * diffuse_intensity;
+
+	// compute specular lighting
+	vec3 specular = vec3(0.0);
+	if (diffuse_intensity > 0.0) {
+		vec3 h = normalize(l + v);
+		float specular_intensity = max(dot(h, n), 0.0);
+		specular = light.specular * material.specular * pow(specular_intensity, material.shininess);
+	}
+
+	// compute color
+	color = vec4(max(diffuse + specular, ambient), f_color.a);
+}
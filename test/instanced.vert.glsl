@@ -0,0 +1,54 @@
+/**
+ * @file instanced.vert.glsl
+ *
+ * Copyright 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#version 460 core
+
+uniform mat4 m_modelview;
+uniform mat3 m_normal;
+uniform mat4 m_view;
+uniform mat4 m_mvp;
+
+struct light_t {
+	vec4 position;
+	vec3 ambient;
+	vec3 diffuse;
+	vec3 specular;
+};
+uniform light_t light;
+
+// Per-vertex attributes
+in vec3 v_position;
+in vec3 v_normal;
+
+// Per-instance attributes
+in mat4 i_model;
+in vec4 i_color;
+
+out vec3 f_n;
+out vec3 f_l;
+out vec3 f_v;
+out vec4 f_color;
+
+void main()
+{
+	// Apply instance transform before the shared model transform. Instance
+	// transforms are assumed to use uniform scaling such that the upper 3x3
+	// is sufficient for transforming normals.
+	vec4 instance_position = i_model * vec4(v_position, 1.0);
+	vec3 instance_normal = mat3(i_model) * v_normal;
+
+	// compute eye space vectors
+	vec4 position = m_modelview * instance_position;
+	f_n = m_normal * instance_normal; // normal vector
+	f_l = vec3(m_view * light.position - position); // light vector
+	f_v = vec3(-position); // viewer vector
+	f_color = i_color;
+
+	gl_Position = m_mvp * instance_position;
+}
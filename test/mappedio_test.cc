@@ -0,0 +1,106 @@
+/**
+ * @file mappedio_test.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "mappedio.h"
+
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <string>
+
+static const char* test_filename = "mappedio_test.txt";
+static const char test_content[] = "0123456789abcdef";
+
+int main()
+{
+	MappedIOSystem io;
+	Assimp::IOStream* stream = nullptr;
+	Assimp::IOStream* other = nullptr;
+	char buf[8];
+	int r = 1;
+
+	FILE* f = std::fopen(test_filename, "wb");
+	if (!f) {
+		std::fprintf(stderr, "Failed to create test file\n");
+		return 1;
+	}
+	std::fputs(test_content, f);
+	std::fclose(f);
+
+	if (!io.Exists(test_filename) || io.Exists("mappedio_test.missing")) {
+		std::fprintf(stderr, "Exists() mismatch\n");
+		goto exit;
+	}
+
+	if (io.Open("mappedio_test.missing") || io.Open(test_filename, "wb")) {
+		std::fprintf(stderr, "Missing files and write modes must fail\n");
+		goto exit;
+	}
+
+	stream = io.Open(test_filename);
+	if (!stream || stream->FileSize() != std::strlen(test_content)) {
+		std::fprintf(stderr, "Failed to open test file\n");
+		goto exit;
+	}
+
+	// Read whole elements only
+	if (stream->Read(buf, 3, 2) != 2 ||
+		std::memcmp(buf, "012345", 6) != 0 ||
+		stream->Tell() != 6
+	) {
+		std::fprintf(stderr, "Read() mismatch\n");
+		goto exit;
+	}
+
+	if (stream->Seek(4, aiOrigin_END) != aiReturn_SUCCESS ||
+		stream->Read(buf, 3, 2) != 1 ||
+		std::memcmp(buf, "cde", 3) != 0 ||
+		stream->Tell() != 15
+	) {
+		std::fprintf(stderr, "Partial Read() mismatch\n");
+		goto exit;
+	}
+
+	if (stream->Seek(2, aiOrigin_CUR) == aiReturn_SUCCESS ||
+		stream->Seek(16, aiOrigin_SET) != aiReturn_SUCCESS ||
+		stream->Read(buf, 1, 1) != 0
+	) {
+		std::fprintf(stderr, "Seek() mismatch\n");
+		goto exit;
+	}
+
+	// Streams of the same file share the mapping but not the position
+	other = io.Open(test_filename);
+	if (!other ||
+		static_cast<MappedIOStream*>(other)->data() != static_cast<MappedIOStream*>(stream)->data() ||
+		other->Tell() != 0
+	) {
+		std::fprintf(stderr, "Shared mapping mismatch\n");
+		goto exit;
+	}
+
+	// Missing files are recorded as well, because creating them may
+	// change the result of an import
+	if (io.accessedFiles() != std::set<std::string>({ test_filename, "mappedio_test.missing" })) {
+		std::fprintf(stderr, "Accessed files mismatch\n");
+		goto exit;
+	}
+
+	r = 0;
+
+exit:
+	if (other) {
+		io.Close(other);
+	}
+	if (stream) {
+		io.Close(stream);
+	}
+	std::remove(test_filename);
+	return r;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file meshlet_test.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "meshlet.h"
+#include "indexoptimizer.h"
+#include "mesh.h"
+#include "testmesh.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// Grids of this size span several meshlets
+static const unsigned int grid_size = 48;
+
+// Valley z=|x-c| along the y axis, which is concave when seen from +z
+static float valley_height(float x, float)
+{
+	return std::fabs(x - grid_size / 2);
+}
+
+static bool cone_culled(const Meshlet& meshlet, const float camera[3])
+{
+	float d[3] = {
+		meshlet.cone_apex[0] - camera[0],
+		meshlet.cone_apex[1] - camera[1],
+		meshlet.cone_apex[2] - camera[2],
+	};
+	float length = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+	float dp = (d[0] * meshlet.cone_axis[0] + d[1] * meshlet.cone_axis[1] + d[2] * meshlet.cone_axis[2]) / length;
+	return dp >= meshlet.cone_cutoff;
+}
+
+// Meshlets with any triangle facing @p camera must not be culled
+static bool front_faces_visible(const Mesh& mesh, const float camera[3])
+{
+	for (const Meshlet& meshlet : mesh.meshlets) {
+		const unsigned int* vertices = &mesh.meshlet_vertices[meshlet.vertex_offset];
+		const unsigned char* local = &mesh.meshlet_triangles[meshlet.triangle_offset];
+		bool front_facing = false;
+
+		for (std::size_t i = 0; i < meshlet.triangle_count * 3 && !front_facing; i += 3) {
+			const float* p0 = &mesh.vertex_data[vertices[local[i]] * mesh.stride];
+			const float* p1 = &mesh.vertex_data[vertices[local[i + 1]] * mesh.stride];
+			const float* p2 = &mesh.vertex_data[vertices[local[i + 2]] * mesh.stride];
+			float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+			float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+			float n[3] = {
+				e1[1] * e2[2] - e1[2] * e2[1],
+				e1[2] * e2[0] - e1[0] * e2[2],
+				e1[0] * e2[1] - e1[1] * e2[0],
+			};
+			float v[3] = { p0[0] - camera[0], p0[1] - camera[1], p0[2] - camera[2] };
+			front_facing = v[0] * n[0] + v[1] * n[1] + v[2] * n[2] < 0.0f;
+		}
+
+		if (front_facing && cone_culled(meshlet, camera)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool validate(const Mesh& mesh)
+{
+	std::vector<std::array<unsigned int, 3>> expected;
+	std::vector<std::array<unsigned int, 3>> triangles;
+
+	for (std::size_t i = 0; i < mesh.index_data.size(); i += 3) {
+		expected.push_back({ mesh.index_data[i], mesh.index_data[i + 1], mesh.index_data[i + 2] });
+	}
+
+	for (const Meshlet& meshlet : mesh.meshlets) {
+		if (meshlet.vertex_count > max_meshlet_vertices ||
+			meshlet.triangle_count > max_meshlet_triangles ||
+			meshlet.triangle_count == 0
+		) {
+			std::fprintf(stderr, "Meshlet exceeds limits\n");
+			return false;
+		}
+
+		const unsigned int* vertices = &mesh.meshlet_vertices[meshlet.vertex_offset];
+		const unsigned char* local = &mesh.meshlet_triangles[meshlet.triangle_offset];
+		for (std::size_t i = 0; i < meshlet.triangle_count * 3; i += 3) {
+			triangles.push_back({ vertices[local[i]], vertices[local[i + 1]], vertices[local[i + 2]] });
+		}
+
+		// Bounding sphere must contain every vertex
+		for (std::size_t i = 0; i < meshlet.vertex_count; ++i) {
+			const float* p = &mesh.vertex_data[vertices[i] * mesh.stride];
+			float dx = p[0] - meshlet.center[0];
+			float dy = p[1] - meshlet.center[1];
+			float dz = p[2] - meshlet.center[2];
+			if (std::sqrt(dx * dx + dy * dy + dz * dz) > meshlet.radius * 1.0001f) {
+				std::fprintf(stderr, "Vertex outside meshlet bounding sphere\n");
+				return false;
+			}
+		}
+
+		// Flat grid must have a tight cone along +z
+		if (std::fabs(meshlet.cone_axis[2] - 1.0f) > 1e-5f ||
+			meshlet.cone_cutoff > 1e-3f
+		) {
+			std::fprintf(stderr, "Unexpected meshlet normal cone\n");
+			return false;
+		}
+	}
+
+	// Every triangle must be covered exactly once, in order
+	if (triangles != expected) {
+		std::fprintf(stderr, "Meshlet triangles differ from mesh triangles\n");
+		return false;
+	}
+
+	return true;
+}
+
+int main()
+{
+	// Flat grid in the z=0 plane facing +z
+	Mesh mesh(Mesh::PrimitiveType::Triangle, grid_size * grid_size);
+	appendGeometry(createGrid(grid_size), mesh);
+	optimizeMesh(&mesh);
+
+	if (!buildMeshlets(&mesh) || mesh.meshlets.empty()) {
+		std::fprintf(stderr, "Failed to build meshlets\n");
+		return 1;
+	}
+	std::printf("%zu triangles in %zu meshlets; %zu meshlet vertices for %zu vertices\n",
+		mesh.index_data.size() / 3,
+		mesh.meshlets.size(),
+		mesh.meshlet_vertices.size(),
+		mesh.vertexCount()
+	);
+
+	if (!validate(mesh)) {
+		return 1;
+	}
+
+	// The grid faces +z, so a camera below it sees only back faces
+	const float camera[3] = { 24.0f, 24.0f, -10.0f };
+	for (const Meshlet& meshlet : mesh.meshlets) {
+		if (!cone_culled(meshlet, camera)) {
+			std::fprintf(stderr, "Back facing meshlet not culled\n");
+			return 1;
+		}
+	}
+
+	// Cameras inside a concave valley, including just above the faces near
+	// the crease, must never cull meshlets they see the front of
+	Mesh valley(Mesh::PrimitiveType::Triangle, grid_size * grid_size);
+	appendGeometry(createGrid(grid_size, valley_height), valley);
+	if (!buildMeshlets(&valley)) {
+		std::fprintf(stderr, "Failed to build valley meshlets\n");
+		return 1;
+	}
+	for (float x = 16.0f; x <= 32.0f; x += 0.51f) {
+		for (float height : { 0.01f, 0.5f, 2.0f, 20.0f }) {
+			const float camera[3] = { x, 24.5f, std::fabs(x - grid_size / 2) + height };
+			if (!front_faces_visible(valley, camera)) {
+				std::fprintf(stderr, "Front facing valley meshlet culled from (%g, %g, %g)\n", camera[0], camera[1], camera[2]);
+				return 1;
+			}
+		}
+	}
+
+	// Cameras around a closed convex sphere cull some meshlets but never
+	// the ones they see
+	Mesh sphere(Mesh::PrimitiveType::Triangle, 0);
+	appendGeometry(createSphere(32, 64), sphere);
+	optimizeMesh(&sphere);
+	if (!buildMeshlets(&sphere)) {
+		std::fprintf(stderr, "Failed to build sphere meshlets\n");
+		return 1;
+	}
+	const std::array<float, 3> directions[] = {
+		{ 0.0f, 0.0f, 1.0f },
+		{ 1.0f, 0.0f, 0.0f },
+		{ 0.6f, -0.48f, 0.64f },
+	};
+	std::size_t culled = 0;
+	for (float distance : { 1.05f, 2.0f, 10.0f }) {
+		for (auto&& direction : directions) {
+			const float camera[3] = {
+				direction[0] * distance,
+				direction[1] * distance,
+				direction[2] * distance,
+			};
+			if (!front_faces_visible(sphere, camera)) {
+				std::fprintf(stderr, "Front facing sphere meshlet culled from (%g, %g, %g)\n", camera[0], camera[1], camera[2]);
+				return 1;
+			}
+			for (const Meshlet& meshlet : sphere.meshlets) {
+				culled += cone_culled(meshlet, camera);
+			}
+		}
+	}
+	if (!culled) {
+		std::fprintf(stderr, "No back facing sphere meshlet culled\n");
+		return 1;
+	}
+
+	// Non-triangle meshes have no meshlets
+	Mesh points(Mesh::PrimitiveType::Point, 1);
+	points.vertex_data = { 0.0f, 0.0f, 0.0f };
+	points.index_data = { 0 };
+	if (buildMeshlets(&points) || !points.meshlets.empty()) {
+		std::fprintf(stderr, "Point meshes must not have meshlets\n");
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file patchmodel_test.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "patchmodel.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Enough patches and control points to span several parallel chunks
+static const std::size_t patch_count = 40000;
+static const std::size_t control_point_count = 50000;
+
+static std::uint32_t index_at(std::size_t patch, std::size_t i)
+{
+	return (patch * 13 + i * 7) % control_point_count;
+}
+
+static float coord_at(std::size_t index, std::size_t c)
+{
+	return static_cast<float>(index) * 0.25f - static_cast<float>(c);
+}
+
+static bool write_text(const char* filename)
+{
+	FILE* f = std::fopen(filename, "w");
+	if (!f) {
+		return false;
+	}
+
+	std::fprintf(f, "\n%zu\n", patch_count);
+	for (std::size_t patch = 0; patch < patch_count; ++patch) {
+		for (std::size_t i = 0; i < 16; ++i) {
+			std::fprintf(f, i ? ",%u" : "%u", index_at(patch, i) + 1);
+		}
+		std::fprintf(f, "\n");
+
+		// Blank lines within a section, including right before the start
+		// of the second parallel chunk of 16384 lines
+		if (patch % 1000 == 999 || patch == 16383) {
+			std::fprintf(f, "\n \t\n");
+		}
+	}
+	std::fprintf(f, "%zu\r\n", control_point_count);
+	for (std::size_t k = 0; k < control_point_count; ++k) {
+		std::fprintf(f, "%.9g,%.9g,%.9g\r\n", coord_at(k, 0), coord_at(k, 1), coord_at(k, 2));
+
+		// Blank CRLF lines
+		if (k % 777 == 0) {
+			std::fprintf(f, "\r\n\r\n");
+		}
+	}
+
+	return std::fclose(f) == 0;
+}
+
+static bool write_binary(const char* filename)
+{
+	FILE* f = std::fopen(filename, "wb");
+	if (!f) {
+		return false;
+	}
+
+	PatchModel::BinaryHeader header;
+	std::memcpy(header.magic, "BPCH", sizeof(header.magic));
+	header.version = 1;
+	header.patch_count = patch_count;
+	header.control_point_count = control_point_count;
+	std::fwrite(&header, sizeof(header), 1, f);
+
+	for (std::size_t patch = 0; patch < patch_count; ++patch) {
+		for (std::size_t i = 0; i < 16; ++i) {
+			std::uint32_t index = index_at(patch, i);
+			std::fwrite(&index, sizeof(index), 1, f);
+		}
+	}
+	for (std::size_t k = 0; k < control_point_count; ++k) {
+		float v[3] = { coord_at(k, 0), coord_at(k, 1), coord_at(k, 2) };
+		std::fwrite(v, sizeof(v), 1, f);
+	}
+
+	return std::fclose(f) == 0;
+}
+
+static bool verify(const PatchModel& model)
+{
+	if (model.size() != patch_count) {
+		std::fprintf(stderr, "Invalid patch count %zu\n", model.size());
+		return false;
+	}
+
+	for (std::size_t patch = 0; patch < patch_count; ++patch) {
+		Teaset::BezierPatch p = model.patch(patch);
+		for (std::size_t i = 0; i < 16; ++i) {
+			std::uint32_t index = index_at(patch, i);
+			const glm::vec3& k = p.k[i / 4][i % 4];
+			if (k.x != coord_at(index, 0) || k.y != coord_at(index, 1) || k.z != coord_at(index, 2)) {
+				std::fprintf(stderr, "Invalid control point %zu of patch %zu\n", i, patch);
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+int main()
+{
+	const char* text_filename = "patchmodel_test.txt";
+	const char* binary_filename = "patchmodel_test.bin";
+	PatchModel model;
+	int r = 1;
+
+	if (!write_text(text_filename) || !write_binary(binary_filename)) {
+		std::fprintf(stderr, "Failed to write test files\n");
+		goto exit;
+	}
+
+	if (!model.load(text_filename) || !verify(model)) {
+		std::fprintf(stderr, "Failed to load text patch model\n");
+		goto exit;
+	}
+
+	if (!model.load(binary_filename) || !verify(model)) {
+		std::fprintf(stderr, "Failed to load binary patch model\n");
+		goto exit;
+	}
+
+	if (model.load("patchmodel_test.missing") || model.size() != 0) {
+		std::fprintf(stderr, "Loading missing file must fail\n");
+		goto exit;
+	}
+
+	r = 0;
+
+exit:
+	std::remove(text_filename);
+	std::remove(binary_filename);
+	return r;
+}
@@ -23,9 +23,8 @@ struct light_t {
 uniform light_t light;
 
 in vec3 v_position;
-in vec3 v_normal;
-in vec3 v_tangent;
-in vec3 v_bitangent;
+in vec2 v_normal; // Octahedral encoded
+in vec4 v_tangent; // Handedness in w
 in vec2 v_texcoord;
 
 out vec3 f_l;
@@ -33,6 +32,15 @@ out vec3 f_v;
 out mat3 f_tbn;
 out vec2 f_texcoord;
 
+vec3 oct_decode(vec2 e)
+{
+	// Unfold lower hemisphere of octahedral mapping
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+	return normalize(n);
+}
+
 void main()
 {
 	// Compute eye space vectors
@@ -40,10 +48,14 @@ void main()
 	f_l = vec3(m_view * light.position - position); // Light vector
 	f_v = vec3(-position); // Viewer vector
 
+	// Decode packed normal and reconstruct bitangent from handedness
+	vec3 normal = oct_decode(v_normal);
+	vec3 bitangent = cross(normal, v_tangent.xyz) * v_tangent.w;
+
 	// Build eye space TBN matrix
-	vec3 T = normalize(m_normal * v_tangent);
-	vec3 B = normalize(m_normal * v_bitangent);
-	vec3 N = normalize(m_normal * v_normal);
+	vec3 T = normalize(m_normal * v_tangent.xyz);
+	vec3 B = normalize(m_normal * bitangent);
+	vec3 N = normalize(m_normal * normal);
 	f_tbn = mat3(T, B, N);
 
 	f_texcoord = v_texcoord;
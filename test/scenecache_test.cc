@@ -0,0 +1,333 @@
+/**
+ * @file scenecache_test.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "scenecache.h"
+#include "entity.h"
+#include "material.h"
+#include "materialtable.h"
+#include "mesh.h"
+#include "meshlet.h"
+#include "simplifier.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+static const char* source_filename = "scenecache_test.src";
+static const char* cache_filename = "scenecache_test.cache";
+static const char* dependency_filename = "scenecache_test.mtl";
+static const char* missing_filename = "scenecache_test.missing";
+
+static bool write_file(const char* filename, const char* content)
+{
+	FILE* f = std::fopen(filename, "wb");
+	if (!f) {
+		return false;
+	}
+	std::fputs(content, f);
+	return std::fclose(f) == 0;
+}
+
+static bool write_source(const char* content)
+{
+	return write_file(source_filename, content);
+}
+
+// Move the modification time back, such that only the content hash matches
+static bool touch(const char* filename)
+{
+	std::error_code ec;
+	auto mtime = std::filesystem::last_write_time(filename, ec);
+	if (!ec) {
+		std::filesystem::last_write_time(filename, mtime - std::chrono::seconds(10), ec);
+	}
+	return !ec;
+}
+
+static std::string read_file(const char* filename)
+{
+	std::ifstream f(filename, std::ios::binary);
+	std::ostringstream content;
+	content << f.rdbuf();
+	return content.str();
+}
+
+static Entity* create_entity()
+{
+	Entity* entity = new Entity("test");
+
+	Material material;
+	material.diffuse = Material::color3_t(0.25f, 0.5f, 0.75f);
+	material.shininess = 8.0f;
+	material.setDefaultShadingMode();
+	std::uint32_t material_index = entity->materials->intern(material);
+
+	Mesh* mesh = entity->createMesh(Mesh::PrimitiveType::Triangle, 3, true);
+	for (std::size_t i = 0; i < 3 * mesh->stride; ++i) {
+		mesh->vertex_data.push_back(i * 0.5f);
+	}
+	mesh->index_data = { 0, 1, 2 };
+	mesh->material_index = material_index;
+	mesh->updateBounds();
+	buildLods(mesh, { 0.5f });
+	buildMeshlets(mesh);
+	entity->meshes.push_back(mesh);
+
+	Mesh* points = entity->createMesh(Mesh::PrimitiveType::Point, 1, false, false, false, true);
+	points->vertex_data = { 1.0f, 2.0f, 3.0f, 0.1f, 0.2f, 0.3f, 0.4f };
+	points->index_data = { 0 };
+	points->material_index = material_index;
+	points->updateBounds();
+	entity->meshes.push_back(points);
+
+	entity->instances.push_back({ mesh, glm::mat4(1.0f) });
+	entity->instances.push_back({ mesh, glm::mat4(2.0f) });
+	entity->instances.push_back({ points, glm::mat4(1.0f) });
+	entity->updateBounds();
+
+	return entity;
+}
+
+static bool compare(const Entity* a, const Entity* b)
+{
+	if (a->materials->size() != b->materials->size() ||
+		a->meshes.size() != b->meshes.size() ||
+		a->instances.size() != b->instances.size()
+	) {
+		return false;
+	}
+
+	if (a->materials->get(0) != b->materials->get(0)) {
+		return false;
+	}
+
+	// Cached bounds are read instead of recomputed
+	if (std::memcmp(&a->bounds, &b->bounds, sizeof(Bounds)) != 0) {
+		return false;
+	}
+
+	for (auto ia = a->meshes.begin(), ib = b->meshes.begin(); ia != a->meshes.end(); ++ia, ++ib) {
+		const Mesh* mesh_a = *ia;
+		const Mesh* mesh_b = *ib;
+		if (mesh_a->primitive_type != mesh_b->primitive_type ||
+			mesh_a->stride != mesh_b->stride ||
+			mesh_a->vertexDataSize() != mesh_b->vertexDataSize() ||
+			mesh_a->indexDataSize() != mesh_b->indexDataSize() ||
+			mesh_a->meshlets.size() != mesh_b->meshlets.size() ||
+			mesh_a->lods.size() != mesh_b->lods.size() ||
+			(!mesh_a->lods.empty() && std::memcmp(mesh_a->lods.data(), mesh_b->lods.data(), mesh_a->lods.size() * sizeof(Mesh::Lod)) != 0) ||
+			mesh_a->meshlet_vertices != mesh_b->meshlet_vertices ||
+			mesh_a->meshlet_triangles != mesh_b->meshlet_triangles ||
+			std::memcmp(mesh_a->vertexData(), mesh_b->vertexData(), mesh_a->vertexDataSize() * sizeof(float)) != 0 ||
+			std::memcmp(mesh_a->indexData(), mesh_b->indexData(), mesh_a->indexDataSize() * sizeof(unsigned int)) != 0 ||
+			(!mesh_a->meshlets.empty() && std::memcmp(mesh_a->meshlets.data(), mesh_b->meshlets.data(), mesh_a->meshlets.size() * sizeof(Meshlet)) != 0) ||
+			std::memcmp(&mesh_a->bounds, &mesh_b->bounds, sizeof(Bounds)) != 0 ||
+			mesh_b->material_index != 0
+		) {
+			return false;
+		}
+
+		// Cached data must be aligned views of the cache file
+		if (!mesh_b->vertex_data.empty() ||
+			reinterpret_cast<std::uintptr_t>(mesh_b->vertexData()) % 64
+		) {
+			return false;
+		}
+	}
+
+	for (std::size_t i = 0; i < a->instances.size(); ++i) {
+		std::size_t mesh_a = std::distance(a->meshes.begin(), std::find(a->meshes.begin(), a->meshes.end(), a->instances[i].mesh));
+		std::size_t mesh_b = std::distance(b->meshes.begin(), std::find(b->meshes.begin(), b->meshes.end(), b->instances[i].mesh));
+		if (mesh_a != mesh_b || a->instances[i].transform != b->instances[i].transform) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int main()
+{
+	Entity* entity = create_entity();
+	Entity* cached = nullptr;
+	int r = 1;
+
+	// Entity bounds include the scaled instance
+	const Bounds& bounds = entity->bounds;
+	if (bounds.min[0] != 0.0f || bounds.min[1] != 0.5f || bounds.min[2] != 1.0f ||
+		bounds.max[0] != 12.0f || bounds.max[1] != 13.0f || bounds.max[2] != 14.0f
+	) {
+		std::fprintf(stderr, "Invalid entity bounds\n");
+		goto exit;
+	}
+
+	if (!write_source("source v1") ||
+		!SceneCache::write(cache_filename, source_filename, entity)
+	) {
+		std::fprintf(stderr, "Failed to write scene cache\n");
+		goto exit;
+	}
+
+	cached = SceneCache::read(cache_filename, source_filename, "test");
+	if (!cached || !compare(entity, cached)) {
+		std::fprintf(stderr, "Scene cache content mismatch\n");
+		goto exit;
+	}
+	delete cached;
+	cached = nullptr;
+
+	// Cached materials must be deduplicated against a shared table
+	cached = SceneCache::read(cache_filename, source_filename, "test", entity->materials);
+	if (!cached || cached->materials != entity->materials || entity->materials->size() != 1) {
+		std::fprintf(stderr, "Cached materials not interned into shared table\n");
+		goto exit;
+	}
+	delete cached;
+	cached = nullptr;
+
+	// Same content but new modification time must validate by hash
+	if (!write_source("source v1") ||
+		!(cached = SceneCache::read(cache_filename, source_filename, "test"))
+	) {
+		std::fprintf(stderr, "Unchanged source must not invalidate scene cache\n");
+		goto exit;
+	}
+	delete cached;
+	cached = nullptr;
+
+	// Changed source must invalidate the cache
+	if (!write_source("source v2") ||
+		(cached = SceneCache::read(cache_filename, source_filename, "test"))
+	) {
+		std::fprintf(stderr, "Changed source must invalidate scene cache\n");
+		goto exit;
+	}
+
+	// Caches written with other processing settings must not be used
+	{
+		SceneCache::ImportSettings settings{ true, { 0.5f, 0.25f }, 0x8 };
+		SceneCache::ImportSettings other_lods{ true, { 0.5f }, 0x8 };
+		SceneCache::ImportSettings other_flags{ true, { 0.5f, 0.25f }, 0x9 };
+		if (!SceneCache::write(cache_filename, source_filename, entity, settings) ||
+			(cached = SceneCache::read(cache_filename, source_filename, "test")) ||
+			(cached = SceneCache::read(cache_filename, source_filename, "test", nullptr, other_lods)) ||
+			(cached = SceneCache::read(cache_filename, source_filename, "test", nullptr, other_flags)) ||
+			!(cached = SceneCache::read(cache_filename, source_filename, "test", nullptr, settings))
+		) {
+			std::fprintf(stderr, "Scene cache settings not validated\n");
+			goto exit;
+		}
+		delete cached;
+		cached = nullptr;
+	}
+
+	// Dependencies, including missing ones, are stamped like the source
+	if (!write_file(dependency_filename, "material v1") ||
+		!SceneCache::write(cache_filename, source_filename, entity, {}, { dependency_filename, missing_filename }) ||
+		!(cached = SceneCache::read(cache_filename, source_filename, "test"))
+	) {
+		std::fprintf(stderr, "Failed to read scene cache with dependencies\n");
+		goto exit;
+	}
+	delete cached;
+	cached = nullptr;
+
+	// Matching the content hash stamps the new modification times once
+	{
+		std::string before = read_file(cache_filename);
+		if (!touch(source_filename) ||
+			!touch(dependency_filename) ||
+			!(cached = SceneCache::read(cache_filename, source_filename, "test"))
+		) {
+			std::fprintf(stderr, "Touched files must not invalidate scene cache\n");
+			goto exit;
+		}
+		delete cached;
+		cached = nullptr;
+
+		std::string restamped = read_file(cache_filename);
+		if (restamped.size() != before.size() || restamped == before) {
+			std::fprintf(stderr, "Scene cache not restamped\n");
+			goto exit;
+		}
+
+		if (!(cached = SceneCache::read(cache_filename, source_filename, "test")) ||
+			read_file(cache_filename) != restamped
+		) {
+			std::fprintf(stderr, "Scene cache restamped twice\n");
+			goto exit;
+		}
+		delete cached;
+		cached = nullptr;
+	}
+
+	// Changed dependencies must invalidate the cache
+	if (!write_file(dependency_filename, "material v2") ||
+		(cached = SceneCache::read(cache_filename, source_filename, "test"))
+	) {
+		std::fprintf(stderr, "Changed dependency must invalidate scene cache\n");
+		goto exit;
+	}
+
+	// Dependencies that were missing must still be missing
+	if (!SceneCache::write(cache_filename, source_filename, entity, {}, { dependency_filename, missing_filename }) ||
+		!write_file(missing_filename, "") ||
+		(cached = SceneCache::read(cache_filename, source_filename, "test"))
+	) {
+		std::fprintf(stderr, "Created dependency must invalidate scene cache\n");
+		goto exit;
+	}
+
+	// Indices outside the vertex data must be rejected
+	entity->meshes.front()->index_data[2] = 3;
+	if (!SceneCache::write(cache_filename, source_filename, entity) ||
+		(cached = SceneCache::read(cache_filename, source_filename, "test"))
+	) {
+		std::fprintf(stderr, "Out of range index not rejected\n");
+		goto exit;
+	}
+	entity->meshes.front()->index_data[2] = 2;
+
+	// Unknown shading modes must be rejected
+	{
+		Entity invalid("invalid");
+		Material material;
+		material.shading_mode = static_cast<Material::ShadingMode>(3);
+		Mesh* mesh = invalid.createMesh(Mesh::PrimitiveType::Point, 1);
+		mesh->vertex_data = { 1.0f, 2.0f, 3.0f };
+		mesh->index_data = { 0 };
+		mesh->material_index = invalid.materials->intern(material);
+		invalid.meshes.push_back(mesh);
+		if (!SceneCache::write(cache_filename, source_filename, &invalid) ||
+			(cached = SceneCache::read(cache_filename, source_filename, "test"))
+		) {
+			std::fprintf(stderr, "Unknown shading mode not rejected\n");
+			goto exit;
+		}
+	}
+
+	r = 0;
+
+exit:
+	delete cached;
+	delete entity;
+	std::remove(source_filename);
+	std::remove(cache_filename);
+	std::remove(dependency_filename);
+	std::remove(missing_filename);
+	return r;
+}
@@ -0,0 +1,214 @@
+/**
+ * @file simplifier_test.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "simplifier.h"
+#include "mesh.h"
+#include "testmesh.h"
+
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <utility>
+#include <vector>
+
+// Gently curved grid with a normal seam down the middle column
+static const unsigned int grid_size = 48;
+static const unsigned int seam_column = grid_size / 2;
+
+static float curve_height(float x, float y)
+{
+	return 0.1f * std::sin(x * 0.3f) * std::cos(y * 0.3f);
+}
+
+static void create_grid(Mesh& mesh)
+{
+	TestGeometry grid = createGrid(grid_size, curve_height);
+	std::vector<unsigned int> right(grid.positions.size());
+
+	for (auto&& p : grid.positions) {
+		mesh.vertex_data.insert(mesh.vertex_data.end(), { p[0], p[1], p[2], 0.0f, 0.0f, 1.0f });
+	}
+
+	// Vertices right of the seam use copies with a different normal
+	for (unsigned int i = 0; i < right.size(); ++i) {
+		right[i] = i;
+	}
+	for (unsigned int y = 0; y < grid_size; ++y) {
+		unsigned int i = y * grid_size + seam_column;
+		const auto& p = grid.positions[i];
+		right[i] = mesh.vertex_data.size() / mesh.stride;
+		mesh.vertex_data.insert(mesh.vertex_data.end(), { p[0], p[1], p[2], 0.0f, 1.0f, 0.0f });
+	}
+
+	for (auto&& t : grid.triangles) {
+		// Triangles are in row order with two per cell
+		unsigned int cell_x = (&t - grid.triangles.data()) / 2 % (grid_size - 1);
+		bool use_copies = cell_x >= seam_column;
+		for (unsigned int v : t) {
+			mesh.index_data.push_back(use_copies ? right[v] : v);
+		}
+	}
+}
+
+static bool validate_level(const Mesh& mesh, const Mesh::Lod& lod)
+{
+	const unsigned int* indices = &mesh.index_data[lod.index_offset];
+	double area = 0.0;
+
+	for (std::size_t i = 0; i < lod.index_count; i += 3) {
+		const float* p[3];
+		bool left = false;
+		bool right = false;
+		for (std::size_t k = 0; k < 3; ++k) {
+			unsigned int v = indices[i + k];
+			p[k] = &mesh.vertex_data[v * mesh.stride];
+
+			// Seam copies are only used right of the seam and the
+			// originals only left of it
+			bool copy = v >= grid_size * grid_size;
+			if (p[k][0] < seam_column || (p[k][0] == seam_column && !copy)) {
+				left = true;
+			} else {
+				right = true;
+			}
+		}
+		if (left && right) {
+			std::fprintf(stderr, "Triangle crosses attribute seam\n");
+			return false;
+		}
+
+		double xy_area = ((p[1][0] - p[0][0]) * (p[2][1] - p[0][1]) - (p[2][0] - p[0][0]) * (p[1][1] - p[0][1])) * 0.5;
+		if (xy_area <= 0.0) {
+			std::fprintf(stderr, "Triangle flipped\n");
+			return false;
+		}
+		area += xy_area;
+	}
+
+	// Unflipped triangles within an unchanged border cover the grid exactly
+	double expected_area = double(grid_size - 1) * (grid_size - 1);
+	if (std::fabs(area - expected_area) > 1e-3) {
+		std::fprintf(stderr, "Border changed; area %f instead of %f\n", area, expected_area);
+		return false;
+	}
+
+	return true;
+}
+
+// Levels of a closed sphere must remain closed and face outwards
+static bool validate_closed_level(const Mesh& mesh, const Mesh::Lod& lod)
+{
+	const unsigned int* indices = &mesh.index_data[lod.index_offset];
+	std::map<std::pair<unsigned int, unsigned int>, unsigned int> edges;
+
+	for (std::size_t i = 0; i < lod.index_count; i += 3) {
+		const float* p[3];
+		for (std::size_t k = 0; k < 3; ++k) {
+			p[k] = &mesh.vertex_data[indices[i + k] * mesh.stride];
+			++edges[{ indices[i + k], indices[i + (k + 1) % 3] }];
+		}
+
+		float e1[3] = { p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2] };
+		float e2[3] = { p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2] };
+		float n[3] = {
+			e1[1] * e2[2] - e1[2] * e2[1],
+			e1[2] * e2[0] - e1[0] * e2[2],
+			e1[0] * e2[1] - e1[1] * e2[0],
+		};
+		float outward = 0.0f;
+		for (std::size_t c = 0; c < 3; ++c) {
+			outward += n[c] * (p[0][c] + p[1][c] + p[2][c]);
+		}
+		if (outward <= 0.0f) {
+			std::fprintf(stderr, "Sphere triangle flipped\n");
+			return false;
+		}
+	}
+
+	// Every edge of a closed surface is used once in each direction
+	for (auto&& [edge, count] : edges) {
+		auto reverse = edges.find({ edge.second, edge.first });
+		if (count != 1 || reverse == edges.end() || reverse->second != 1) {
+			std::fprintf(stderr, "Sphere no longer closed\n");
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int main()
+{
+	Mesh mesh(Mesh::PrimitiveType::Triangle, grid_size * (grid_size + 1), true);
+	create_grid(mesh);
+	std::size_t triangle_count = mesh.index_data.size() / 3;
+
+	if (!buildLods(&mesh, { 0.5f, 0.25f, 0.12f }) || mesh.lods.size() != 4) {
+		std::fprintf(stderr, "Failed to build levels of detail\n");
+		return 1;
+	}
+
+	float previous_error = 0.0f;
+	for (std::size_t level = 0; level < mesh.lods.size(); ++level) {
+		const Mesh::Lod& lod = mesh.lods[level];
+		std::printf("LOD %zu: %u triangles, error %f\n", level, lod.index_count / 3, lod.error);
+
+		if (lod.index_offset + lod.index_count > mesh.index_data.size() ||
+			lod.error < previous_error ||
+			(level > 0 && lod.index_count >= mesh.lods[level - 1].index_count)
+		) {
+			std::fprintf(stderr, "Invalid level of detail\n");
+			return 1;
+		}
+		previous_error = lod.error;
+
+		if (!validate_level(mesh, lod)) {
+			return 1;
+		}
+	}
+
+	// Budgets are approximate because collapses may be rejected
+	if (mesh.lods[1].index_count / 3 > triangle_count * 0.55 ||
+		mesh.lods[3].index_count / 3 > triangle_count * 0.2
+	) {
+		std::fprintf(stderr, "Triangle budget not reached\n");
+		return 1;
+	}
+
+	// Closed meshes have no border to preserve and may be simplified
+	// everywhere without opening holes
+	Mesh sphere(Mesh::PrimitiveType::Triangle, 0);
+	appendGeometry(createSphere(32, 64), sphere);
+	std::size_t sphere_triangle_count = sphere.index_data.size() / 3;
+	if (!buildLods(&sphere, { 0.5f, 0.25f, 0.12f }) || sphere.lods.size() != 4) {
+		std::fprintf(stderr, "Failed to build sphere levels of detail\n");
+		return 1;
+	}
+	for (std::size_t level = 0; level < sphere.lods.size(); ++level) {
+		const Mesh::Lod& lod = sphere.lods[level];
+		std::printf("Sphere LOD %zu: %u triangles, error %f\n", level, lod.index_count / 3, lod.error);
+		if (!validate_closed_level(sphere, lod)) {
+			return 1;
+		}
+	}
+	if (sphere.lods[3].index_count / 3 > sphere_triangle_count * 0.2 ||
+		sphere.lods[3].error > 0.2f
+	) {
+		std::fprintf(stderr, "Sphere triangle budget or error not reached\n");
+		return 1;
+	}
+
+	// Levels of detail must not be built twice
+	if (buildLods(&mesh, { 0.5f })) {
+		std::fprintf(stderr, "Levels of detail built twice\n");
+		return 1;
+	}
+
+	return 0;
+}
@@ -1,7 +1,7 @@
 /**
  * @file teaset_test.cc
  *
- * Copyright (c) 2013 Leon Lynch
+ * Copyright (c) 2013, 2026 Leon Lynch
  *
  * This file is licensed under the terms of the MIT license.
  * See LICENSE file.
@@ -14,4 +14,15 @@ int main()
 	Teapot teapot;
 	Teacup teacup;
 	Teaspoon teaspoon;
+
+	// Shared instances must be unique and view the same geometry
+	if (&Teapot::shared() != &Teapot::shared() ||
+		Teapot::shared().size() != teapot.size() ||
+		Teacup::shared().size() != teacup.size() ||
+		Teaspoon::shared().size() != teaspoon.size()
+	) {
+		return 1;
+	}
+
+	return 0;
 }
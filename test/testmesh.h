@@ -0,0 +1,119 @@
+/**
+ * @file testmesh.h
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#ifndef CORTEX_TEST_MESH_H
+#define CORTEX_TEST_MESH_H
+
+#include "mesh.h"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Indexed triangle geometry shared by the mesh processing tests.
+ *
+ * Triangles are counter-clockwise when seen from the front, which is +z for
+ * grids and the outside for spheres.
+ */
+struct TestGeometry {
+	std::vector<std::array<float, 3>> positions;
+	std::vector<std::array<unsigned int, 3>> triangles;
+};
+
+/// Grid height function, e.g. a curved surface or a valley
+using GridHeight = float (*)(float x, float y);
+
+/**
+ * Grid of @p size x @p size vertices at integer x,y coordinates with
+ * z = @p height(x, y), or in the z=0 plane if @p height is nullptr. Vertex
+ * (x, y) has index y * @p size + x and the triangles are in row order.
+ */
+inline TestGeometry createGrid(unsigned int size, GridHeight height = nullptr)
+{
+	TestGeometry geometry;
+
+	for (unsigned int y = 0; y < size; ++y) {
+		for (unsigned int x = 0; x < size; ++x) {
+			float z = height ? height(float(x), float(y)) : 0.0f;
+			geometry.positions.push_back({ float(x), float(y), z });
+		}
+	}
+
+	for (unsigned int y = 0; y + 1 < size; ++y) {
+		for (unsigned int x = 0; x + 1 < size; ++x) {
+			unsigned int i = y * size + x;
+			geometry.triangles.push_back({ i, i + 1, i + size });
+			geometry.triangles.push_back({ i + 1, i + size + 1, i + size });
+		}
+	}
+
+	return geometry;
+}
+
+/**
+ * Closed unit sphere around the origin with @p rings latitude bands and
+ * @p segments longitude segments. Every position is stored once, including
+ * the poles and the longitude seam, such that the sphere has no border.
+ */
+inline TestGeometry createSphere(unsigned int rings, unsigned int segments)
+{
+	const float pi = 3.14159265f;
+	TestGeometry geometry;
+
+	// North pole, inner rings and south pole
+	geometry.positions.push_back({ 0.0f, 0.0f, 1.0f });
+	for (unsigned int i = 1; i < rings; ++i) {
+		float theta = pi * i / rings;
+		for (unsigned int j = 0; j < segments; ++j) {
+			float phi = 2.0f * pi * j / segments;
+			geometry.positions.push_back({
+				std::sin(theta) * std::cos(phi),
+				std::sin(theta) * std::sin(phi),
+				std::cos(theta)
+			});
+		}
+	}
+	unsigned int south = geometry.positions.size();
+	geometry.positions.push_back({ 0.0f, 0.0f, -1.0f });
+
+	auto v = [segments](unsigned int ring, unsigned int segment) {
+		return 1 + (ring - 1) * segments + segment % segments;
+	};
+	for (unsigned int j = 0; j < segments; ++j) {
+		geometry.triangles.push_back({ 0, v(1, j), v(1, j + 1) });
+		for (unsigned int i = 1; i + 1 < rings; ++i) {
+			geometry.triangles.push_back({ v(i, j), v(i + 1, j), v(i + 1, j + 1) });
+			geometry.triangles.push_back({ v(i, j), v(i + 1, j + 1), v(i, j + 1) });
+		}
+		geometry.triangles.push_back({ v(rings - 1, j), south, v(rings - 1, j + 1) });
+	}
+
+	return geometry;
+}
+
+/**
+ * Append @p geometry to the vertex and index data of @p mesh. Attributes
+ * after the position are zero.
+ */
+inline void appendGeometry(const TestGeometry& geometry, Mesh& mesh)
+{
+	unsigned int first = mesh.vertex_data.size() / mesh.stride;
+
+	for (auto&& p : geometry.positions) {
+		mesh.vertex_data.insert(mesh.vertex_data.end(), p.begin(), p.end());
+		mesh.vertex_data.resize(mesh.vertex_data.size() + mesh.stride - 3, 0.0f);
+	}
+	for (auto&& t : geometry.triangles) {
+		mesh.index_data.insert(mesh.index_data.end(), { first + t[0], first + t[1], first + t[2] });
+	}
+}
+
+#endif
@@ -16,6 +16,7 @@
 #include <cstdio>
 #include <cstring>
 
+#include <chrono>
 #include <string>
 #include <map>
 #include <vector>
@@ -39,8 +40,12 @@
 #include "teaset.h"
 #include "sphere.h"
 #include "shape.h"
+#include "topology.h"
 #include "gldebug.h"
 #include "glhelpers.h"
+#include "packed.h"
+#include "vaocache.h"
+#include "vertex_buffer.h"
 #include "vertex_traits.h"
 
 static bool ready = 0;
@@ -48,6 +53,7 @@ static int width = 0;
 static int height = 0;
 static unsigned int tick = 0;
 static bool render_normals = false;
+static bool benchmark = false;
 
 struct shader_program_t {
 	GLuint program = 0;
@@ -88,20 +94,37 @@ struct textured_vertex_t {
 	glm::vec2 texcoord;
 };
 
+// Attributes of split vertex buffers; positions are stored separately
+struct normal_attributes_t {
+	glm::vec3 normal;
+};
+using split_vertices_t = SplitVertexBuffer<glm::vec3, normal_attributes_t>;
+
+// Packed vertex of 24 bytes; the shader reconstructs the bitangent
 struct pbr_vertex_t {
 	glm::vec3 position;
-	glm::vec3 normal;
-	glm::vec3 tangent;
-	glm::vec3 bitangent;
-	glm::vec2 texcoord;
+	OctahedralNormal normal;
+	PackedTangent tangent;
+	HalfTexcoord texcoord;
+};
+
+struct line_vertex_t {
+	glm::vec3 position;
 };
 
 struct normals_t {
 	GLuint vao = 0;
 
+	// Line buffer of interleaved meshes
 	GLuint vbo = 0;
 	GLuint vbo_binding = 0;
+	GLsizei vbo_stride = 0;
 	GLsizei vertex_count = 0;
+
+	// Split meshes draw their normal lines from the mesh streams as one
+	// instance per vertex and have no line buffer
+	GLuint attribute_binding = 2;
+	GLuint position_binding = 3;
 };
 
 struct texture_unit_t {
@@ -114,6 +137,12 @@ struct mesh_t {
 
 	GLuint vbo = 0;
 	GLuint vbo_binding = 0;
+	GLsizei vbo_stride = 0;
+
+	// Separate position stream of split vertex buffers
+	GLuint position_vbo = 0;
+	GLuint position_binding = 1;
+	GLsizei position_stride = 0;
 	GLsizei vertex_count = 0;
 
 	GLuint ibo = 0;
@@ -126,10 +155,76 @@ struct mesh_t {
 	const shader_program_t* shader = nullptr;
 };
 
+struct topology_buffer_t {
+	GLuint ibo = 0;
+	GLsizei index_count = 0;
+};
+
+struct parametric_part_t {
+	GLint base_vertex = 0;
+	GridTopology topology{};
+	glm::vec3 translation;
+	glm::vec3 color;
+};
+
+struct instance_t {
+	glm::mat4 model;
+	glm::vec4 color;
+};
+
+enum shape_type_t {
+	SHAPE_CUBE,
+	SHAPE_OCTAHEDRON,
+	SHAPE_COUNT,
+};
+
+struct shape_batch_t {
+	GLuint vao = 0;
+
+	GLuint vbo = 0;
+	GLuint vbo_binding = 0;
+
+	GLuint ibo = 0;
+	GLsizei index_count = 0;
+
+	// Instances written to the current frame's region of the instance buffer
+	GLsizei instance_count = 0;
+};
+
+// Number of instance buffer regions that may be in flight at once
+#define SHAPE_RENDERER_FRAMES (3)
+
+struct shape_renderer_t {
+	// Persistently mapped instance buffer. It is divided into one region per
+	// in-flight frame and each region holds @c capacity instances per shape
+	// type. A fence per region prevents overwriting instance data that the GPU
+	// has not consumed yet.
+	GLuint instance_buffer = 0;
+	GLuint instance_binding = 1;
+	GLsizei capacity = 0;
+	instance_t* instances = nullptr;
+	GLsync fences[SHAPE_RENDERER_FRAMES] = {};
+	unsigned int frame = 0;
+
+	shape_batch_t batches[SHAPE_COUNT];
+
+	const shader_program_t* shader = nullptr;
+};
+
+struct benchmark_t {
+	std::chrono::steady_clock::time_point start;
+	unsigned long long instance_count = 0;
+	unsigned int frame_count = 0;
+};
+
 // Shader programs
 static shader_program_t simple_shader;
 static shader_program_t textured_shader;
 static shader_program_t pbr_shader;
+static shader_program_t instanced_shader;
+
+// Vertex array objects shared by meshes with the same layout and shader
+static VertexArrayCache vao_cache;
 
 // Cube mesh
 static Cube cube;
@@ -157,20 +252,17 @@ static std::vector<unsigned int> bezier_surface_indices;
 static mesh_t bezier_surface_mesh;
 
 // Utah teapot
-static Teapot teapot;
-static std::vector<vertex_t> teapot_vertices;
+static split_vertices_t teapot_vertices;
 static std::vector<unsigned int> teapot_indices;
 static mesh_t teapot_mesh;
 
 // Utah teacup
-static Teacup teacup;
-static std::vector<vertex_t> teacup_vertices;
+static split_vertices_t teacup_vertices;
 static std::vector<unsigned int> teacup_indices;
 static mesh_t teacup_mesh;
 
 // Utah teaspoon
-static Teaspoon teaspoon;
-static std::vector<vertex_t> teaspoon_vertices;
+static split_vertices_t teaspoon_vertices;
 static std::vector<unsigned int> teaspoon_indices;
 static mesh_t teaspoon_mesh;
 
@@ -180,6 +272,26 @@ static std::vector<vertex_t> sphere_vertices;
 static std::vector<unsigned int> sphere_indices;
 static mesh_t sphere_mesh;
 
+// Parametric shapes
+// All parts share a single vertex buffer and, when tessellated with equal
+// sample counts, a single index buffer that is drawn with a base vertex
+static Cylinder cylinder(0.6f, 1.6f);
+static Cone cone(0.8f, 1.6f);
+static Capsule capsule(0.5f, 0.8f);
+static Torus torus(0.8f, 0.3f);
+static std::vector<vertex_t> parametric_vertices;
+static parametric_part_t parametric_parts[4];
+static mesh_t parametric_mesh;
+
+// Index buffers shared by all meshes with equal grid topology
+static TopologyCache topology_cache;
+static std::map<GridTopology, topology_buffer_t> topology_buffers;
+
+// Instanced shapes
+#define INSTANCED_GRID_SIZE (32)
+static shape_renderer_t shape_renderer;
+static benchmark_t instanced_benchmark;
+
 // Helper function declarations
 template<typename VertexType>
 static void scene_update_mesh(
@@ -192,6 +304,11 @@ static void scene_update_mesh_normals(
 	const std::vector<VertexType>& vertices,
 	normals_t* normals
 );
+static void scene_update_mesh(
+	const split_vertices_t& vertices,
+	const std::vector<unsigned int>& indices,
+	mesh_t* mesh
+);
 static void scene_unload_shader_program(shader_program_t* shader_program);
 
 
@@ -514,6 +631,17 @@ exit:
 	return r;
 }
 
+template<typename VertexType>
+static GLuint scene_get_vao(const shader_program_t* shader, GLuint binding)
+{
+	return vao_cache.get<VertexType>(
+		[shader](const char* name) -> GLint {
+			return shader->has_attribute(name) ? shader->attribute(name) : -1;
+		},
+		binding
+	);
+}
+
 template<typename VertexType>
 static void scene_load_mesh(
 	const std::vector<VertexType>& vertices,
@@ -523,63 +651,66 @@ static void scene_load_mesh(
 {
 	// VAO layout:
 	// - VBO #0 for interleaved vertex data:
-	//   position, normal, tangent, bitangent, texcoord
+	//   position, normal, tangent, texcoord
 	// - IBO for element indexes
+	// The VAO is shared with other meshes of the same layout and shader
+	// attribute locations. Buffers are bound by scene_bind_mesh() before
+	// drawing.
 
-	// Create vertex array object and vertex/index buffer objects
-	glCreateVertexArrays(1, &mesh->vao);
+	// Retrieve vertex array object and create vertex/index buffer objects
+	mesh->vao = scene_get_vao<VertexType>(shader, mesh->vbo_binding);
+	mesh->vbo_stride = sizeof(VertexType);
 	glCreateBuffers(1, &mesh->vbo);
 	glCreateBuffers(1, &mesh->ibo);
 
-	// Bind buffer objects to vertex array object
-	glVertexArrayVertexBuffer(mesh->vao, mesh->vbo_binding, mesh->vbo, 0, sizeof(VertexType));
-	glVertexArrayElementBuffer(mesh->vao, mesh->ibo);
+	mesh->shader = shader;
 
-	// Setup format and binding for vertex position
-	GLuint pos_loc = shader->attribute("v_position");
-	glEnableVertexArrayAttrib(mesh->vao, pos_loc);
-	glVertexArrayAttribBinding(mesh->vao, pos_loc, mesh->vbo_binding);
-	glVertexArrayAttribFormat(mesh->vao, pos_loc, 3, GL_FLOAT, GL_FALSE, 0);
+	// Load data
+	scene_update_mesh(vertices, indices, mesh);
+}
 
-	// Setup format and binding for vertex normal
-	if constexpr (detail::has_normal<VertexType>::value) {
-		if (shader->has_attribute("v_normal")) {
-			GLuint norm_loc = shader->attribute("v_normal");
-			glEnableVertexArrayAttrib(mesh->vao, norm_loc);
-			glVertexArrayAttribBinding(mesh->vao, norm_loc, mesh->vbo_binding);
-			glVertexArrayAttribFormat(mesh->vao, norm_loc, 3, GL_FLOAT, GL_FALSE, offsetof(VertexType, normal));
-		}
-	}
+template<typename VertexType>
+static void scene_update_mesh(
+	const std::vector<VertexType>& vertices,
+	const std::vector<unsigned int>& indices,
+	mesh_t* mesh)
+{
+	// Update existing vertex buffer object
+	glNamedBufferData(mesh->vbo, vertices.size() * sizeof(VertexType), vertices.data(), GL_DYNAMIC_DRAW);
+	mesh->vertex_count = vertices.size();
 
-	// Setup format and binding for vertex tangent
-	if constexpr (detail::has_tangent<VertexType>::value) {
-		if (shader->has_attribute("v_tangent")) {
-			GLuint tan_loc = shader->attribute("v_tangent");
-			glEnableVertexArrayAttrib(mesh->vao, tan_loc);
-			glVertexArrayAttribBinding(mesh->vao, tan_loc, mesh->vbo_binding);
-			glVertexArrayAttribFormat(mesh->vao, tan_loc, 3, GL_FLOAT, GL_FALSE, offsetof(VertexType, tangent));
-		}
-	}
+	// Update existing index buffer object
+	glNamedBufferData(mesh->ibo, indices.size() * sizeof(unsigned int), indices.data(), GL_DYNAMIC_DRAW);
+	mesh->index_count = indices.size();
 
-	// Setup format and binding for vertex bitangent
-	if constexpr (detail::has_bitangent<VertexType>::value) {
-		if (shader->has_attribute("v_bitangent")) {
-			GLuint btan_loc = shader->attribute("v_bitangent");
-			glEnableVertexArrayAttrib(mesh->vao, btan_loc);
-			glVertexArrayAttribBinding(mesh->vao, btan_loc, mesh->vbo_binding);
-			glVertexArrayAttribFormat(mesh->vao, btan_loc, 3, GL_FLOAT, GL_FALSE, offsetof(VertexType, bitangent));
-		}
-	}
+	printf("%s(); vao=%u; vbo=%u[%zu]; ibo=%u[%zu]\n", __FUNCTION__, mesh->vao, mesh->vbo, vertices.size(), mesh->ibo, indices.size());
+}
 
-	// Setup format and binding for texture coordinates
-	if constexpr (detail::has_texcoord<VertexType>::value) {
-		if (shader->has_attribute("v_texcoord")) {
-			GLuint tc_loc = shader->attribute("v_texcoord");
-			glEnableVertexArrayAttrib(mesh->vao, tc_loc);
-			glVertexArrayAttribBinding(mesh->vao, tc_loc, mesh->vbo_binding);
-			glVertexArrayAttribFormat(mesh->vao, tc_loc, 2, GL_FLOAT, GL_FALSE, offsetof(VertexType, texcoord));
-		}
-	}
+static void scene_load_mesh(
+	const split_vertices_t& vertices,
+	const std::vector<unsigned int>& indices,
+	const shader_program_t* shader,
+	mesh_t* mesh)
+{
+	// VAO layout:
+	// - VBO #1 for position only, such that position-only passes fetch
+	//   12 bytes per vertex
+	// - VBO #0 for interleaved remaining vertex data
+	// - IBO for element indexes
+
+	// Retrieve vertex array object and create vertex/index buffer objects
+	mesh->vao = vao_cache.getSplit<glm::vec3, normal_attributes_t>(
+		[shader](const char* name) -> GLint {
+			return shader->has_attribute(name) ? shader->attribute(name) : -1;
+		},
+		mesh->position_binding,
+		mesh->vbo_binding
+	);
+	mesh->vbo_stride = sizeof(normal_attributes_t);
+	mesh->position_stride = sizeof(glm::vec3);
+	glCreateBuffers(1, &mesh->position_vbo);
+	glCreateBuffers(1, &mesh->vbo);
+	glCreateBuffers(1, &mesh->ibo);
 
 	mesh->shader = shader;
 
@@ -587,26 +718,34 @@ static void scene_load_mesh(
 	scene_update_mesh(vertices, indices, mesh);
 }
 
-template<typename VertexType>
 static void scene_update_mesh(
-	const std::vector<VertexType>& vertices,
+	const split_vertices_t& vertices,
 	const std::vector<unsigned int>& indices,
 	mesh_t* mesh)
 {
-	// Update existing vertex buffer object
-	glNamedBufferData(mesh->vbo, vertices.size() * sizeof(VertexType), vertices.data(), GL_DYNAMIC_DRAW);
+	// Update existing vertex buffer objects
+	glNamedBufferData(mesh->position_vbo, vertices.positions.size() * sizeof(glm::vec3), vertices.positions.data(), GL_DYNAMIC_DRAW);
+	glNamedBufferData(mesh->vbo, vertices.attributes.size() * sizeof(normal_attributes_t), vertices.attributes.data(), GL_DYNAMIC_DRAW);
 	mesh->vertex_count = vertices.size();
 
 	// Update existing index buffer object
 	glNamedBufferData(mesh->ibo, indices.size() * sizeof(unsigned int), indices.data(), GL_DYNAMIC_DRAW);
 	mesh->index_count = indices.size();
 
-	printf("%s(); vao=%u; vbo=%u[%zu]; ibo=%u[%zu]\n", __FUNCTION__, mesh->vao, mesh->vbo, vertices.size(), mesh->ibo, indices.size());
+	printf("%s(); vao=%u; vbo=%u,%u[%zu]; ibo=%u[%zu]\n", __FUNCTION__, mesh->vao, mesh->position_vbo, mesh->vbo, vertices.size(), mesh->ibo, indices.size());
 }
 
-template<typename VertexType>
+static void scene_bind_mesh(const mesh_t* mesh)
+{
+	VertexArrayCache::bind(mesh->vao, mesh->vbo_binding, mesh->vbo, mesh->vbo_stride, mesh->ibo);
+	if (mesh->position_vbo) {
+		glVertexArrayVertexBuffer(mesh->vao, mesh->position_binding, mesh->position_vbo, 0, mesh->position_stride);
+	}
+}
+
+template<typename VertexBuffer>
 static void scene_load_mesh_normals(
-	const std::vector<VertexType>& vertices,
+	const VertexBuffer& vertices,
 	const shader_program_t* shader,
 	normals_t* normals
 )
@@ -615,19 +754,11 @@ static void scene_load_mesh_normals(
 	// - VBO #0 for position
 	// - No IBO
 
-	// Create vertex array object and vertex buffer object
-	glCreateVertexArrays(1, &normals->vao);
+	// Retrieve vertex array object and create vertex buffer object
+	normals->vao = scene_get_vao<line_vertex_t>(shader, normals->vbo_binding);
+	normals->vbo_stride = sizeof(line_vertex_t);
 	glCreateBuffers(1, &normals->vbo);
 
-	// Bind vertex buffer to vertex array object
-	glVertexArrayVertexBuffer(normals->vao, normals->vbo_binding, normals->vbo, 0, sizeof(glm::vec3));
-
-	// Setup format and binding for vertex data
-	GLuint pos_loc = shader->attribute("v_position");
-	glEnableVertexArrayAttrib(normals->vao, pos_loc);
-	glVertexArrayAttribBinding(normals->vao, pos_loc, normals->vbo_binding);
-	glVertexArrayAttribFormat(normals->vao, pos_loc, 3, GL_FLOAT, GL_FALSE, 0);
-
 	// Load data
 	scene_update_mesh_normals(vertices, normals);
 }
@@ -645,7 +776,7 @@ static void scene_update_mesh_normals(
 	for (auto&& vertex : vertices) {
 		normal_lines.emplace_back(
 			vertex.position,
-			vertex.position + (glm::normalize(vertex.normal) * 0.3f)
+			vertex.position + (glm::normalize(detail::unpack<glm::vec3>(vertex.normal)) * 0.3f)
 		);
 	}
 
@@ -656,6 +787,340 @@ static void scene_update_mesh_normals(
 	printf("%s(); vao=%u; vbo=%u[%zu]\n", __FUNCTION__, normals->vao, normals->vbo, normal_lines.size());
 }
 
+static void scene_load_mesh_normals(
+	const split_vertices_t& vertices,
+	const shader_program_t* shader,
+	normals_t* normals
+)
+{
+	// VAO layout:
+	// - Position stream of the mesh in its own binding (divisor 1)
+	// - Attribute stream of the mesh in its own binding (divisor 1)
+	// - No IBO
+	// Each normal line is an instance of two vertices and the vertex shader
+	// offsets the second vertex along the normal, such that no line buffer
+	// is generated or updated. Buffers are bound before drawing.
+
+	// Retrieve vertex array object
+	normals->vao = vao_cache.getSplit<glm::vec3, normal_attributes_t>(
+		[shader](const char* name) -> GLint {
+			return shader->has_attribute(name) ? shader->attribute(name) : -1;
+		},
+		normals->position_binding,
+		normals->attribute_binding
+	);
+	glVertexArrayBindingDivisor(normals->vao, normals->position_binding, 1);
+	glVertexArrayBindingDivisor(normals->vao, normals->attribute_binding, 1);
+
+	printf("%s(); vao=%u; instances=%zu\n", __FUNCTION__, normals->vao, vertices.size());
+}
+
+static void scene_bind_mesh_normals(const mesh_t* mesh)
+{
+	const normals_t* normals = &mesh->normals;
+	if (normals->vbo) {
+		VertexArrayCache::bind(normals->vao, normals->vbo_binding, normals->vbo, normals->vbo_stride);
+	} else {
+		VertexArrayCache::bind(normals->vao, normals->attribute_binding, mesh->vbo, mesh->vbo_stride);
+		glVertexArrayVertexBuffer(normals->vao, normals->position_binding, mesh->position_vbo, 0, mesh->position_stride);
+	}
+}
+
+static const topology_buffer_t* scene_load_topology(const GridTopology& topology)
+{
+	auto itr = topology_buffers.find(topology);
+	if (itr != topology_buffers.end()) {
+		return &itr->second;
+	}
+
+	// Create immutable index buffer from cached topology index data
+	std::shared_ptr<const TopologyCache::IndexBuffer> indices = topology_cache.get(topology);
+	topology_buffer_t& buffer = topology_buffers[topology];
+	glCreateBuffers(1, &buffer.ibo);
+	glNamedBufferStorage(buffer.ibo, indices->size() * sizeof(unsigned int), indices->data(), 0);
+	buffer.index_count = indices->size();
+
+	printf("%s(); rows=%zu; cols=%zu; ibo=%u[%zu]\n", __FUNCTION__, topology.rows, topology.cols, buffer.ibo, indices->size());
+	return &buffer;
+}
+
+static void scene_tessellate_parametric(std::size_t u_count, std::size_t v_count)
+{
+	parametric_vertices.clear();
+
+	auto tessellate_part = [&](const auto& shape, parametric_part_t* part) {
+		part->base_vertex = parametric_vertices.size();
+		part->topology = shape.topology(u_count, v_count);
+		shape.tessellate(u_count, v_count, parametric_vertices);
+		scene_load_topology(part->topology);
+	};
+	tessellate_part(cylinder, &parametric_parts[0]);
+	tessellate_part(cone, &parametric_parts[1]);
+	tessellate_part(capsule, &parametric_parts[2]);
+	tessellate_part(torus, &parametric_parts[3]);
+
+	// Update existing vertex buffer object
+	glNamedBufferData(parametric_mesh.vbo, parametric_vertices.size() * sizeof(vertex_t), parametric_vertices.data(), GL_DYNAMIC_DRAW);
+	parametric_mesh.vertex_count = parametric_vertices.size();
+
+	printf("%s(); vao=%u; vbo=%u[%zu]\n", __FUNCTION__, parametric_mesh.vao, parametric_mesh.vbo, parametric_vertices.size());
+}
+
+static void scene_load_parametric(std::size_t u_count, std::size_t v_count, const shader_program_t* shader)
+{
+	// VAO layout:
+	// - VBO #0 for interleaved vertex data of all parts:
+	//   position, normal
+	// - IBO is bound per part from the shared topology buffers
+
+	// Retrieve vertex array object and create vertex buffer object
+	parametric_mesh.vao = scene_get_vao<vertex_t>(shader, parametric_mesh.vbo_binding);
+	parametric_mesh.vbo_stride = sizeof(vertex_t);
+	glCreateBuffers(1, &parametric_mesh.vbo);
+
+	parametric_mesh.shader = shader;
+
+	// Part placement and colour
+	parametric_parts[0].translation = glm::vec3(-1.5f,  1.2f, 0.0f);
+	parametric_parts[0].color = glm::vec3(0.8f, 0.0f, 0.0f);
+	parametric_parts[1].translation = glm::vec3( 1.5f,  1.2f, 0.0f);
+	parametric_parts[1].color = glm::vec3(0.0f, 0.8f, 0.0f);
+	parametric_parts[2].translation = glm::vec3(-1.5f, -1.2f, 0.0f);
+	parametric_parts[2].color = glm::vec3(0.0f, 0.0f, 0.8f);
+	parametric_parts[3].translation = glm::vec3( 1.5f, -1.2f, 0.0f);
+	parametric_parts[3].color = glm::vec3(0.8f, 0.8f, 0.0f);
+
+	// Load data
+	scene_tessellate_parametric(u_count, v_count);
+}
+
+static void scene_unload_topology_buffers(void)
+{
+	for (auto& itr : topology_buffers) {
+		glDeleteBuffers(1, &itr.second.ibo);
+	}
+	topology_buffers.clear();
+	topology_cache.clear();
+}
+
+template<typename VertexType>
+static void scene_load_shape_batch(
+	const std::vector<VertexType>& vertices,
+	const std::vector<unsigned int>& indices,
+	const shape_renderer_t* renderer,
+	shape_batch_t* batch
+)
+{
+	const shader_program_t* shader = renderer->shader;
+
+	// VAO layout:
+	// - VBO #0 for interleaved vertex data:
+	//   position, normal
+	// - VBO #1 for interleaved per-instance data (divisor 1):
+	//   model matrix, colour
+	// - IBO for element indexes
+
+	// Create vertex array object and vertex/index buffer objects
+	glCreateVertexArrays(1, &batch->vao);
+	glCreateBuffers(1, &batch->vbo);
+	glCreateBuffers(1, &batch->ibo);
+
+	// Bind buffer objects to vertex array object
+	// The instance buffer is bound per draw at the offset of the current frame
+	glVertexArrayVertexBuffer(batch->vao, batch->vbo_binding, batch->vbo, 0, sizeof(VertexType));
+	glVertexArrayVertexBuffer(batch->vao, renderer->instance_binding, renderer->instance_buffer, 0, sizeof(instance_t));
+	glVertexArrayBindingDivisor(batch->vao, renderer->instance_binding, 1);
+	glVertexArrayElementBuffer(batch->vao, batch->ibo);
+
+	// Setup format and binding for vertex position
+	GLuint pos_loc = shader->attribute("v_position");
+	glEnableVertexArrayAttrib(batch->vao, pos_loc);
+	glVertexArrayAttribBinding(batch->vao, pos_loc, batch->vbo_binding);
+	glVertexArrayAttribFormat(batch->vao, pos_loc, 3, GL_FLOAT, GL_FALSE, 0);
+
+	// Setup format and binding for vertex normal
+	GLuint norm_loc = shader->attribute("v_normal");
+	glEnableVertexArrayAttrib(batch->vao, norm_loc);
+	glVertexArrayAttribBinding(batch->vao, norm_loc, batch->vbo_binding);
+	glVertexArrayAttribFormat(batch->vao, norm_loc, 3, GL_FLOAT, GL_FALSE, offsetof(VertexType, normal));
+
+	// Setup format and binding for instance model matrix
+	// A mat4 attribute occupies four consecutive locations; one per column
+	GLuint model_loc = shader->attribute("i_model");
+	for (GLuint col = 0; col < 4; ++col) {
+		glEnableVertexArrayAttrib(batch->vao, model_loc + col);
+		glVertexArrayAttribBinding(batch->vao, model_loc + col, renderer->instance_binding);
+		glVertexArrayAttribFormat(batch->vao, model_loc + col, 4, GL_FLOAT, GL_FALSE, offsetof(instance_t, model) + col * sizeof(glm::vec4));
+	}
+
+	// Setup format and binding for instance colour
+	GLuint color_loc = shader->attribute("i_color");
+	glEnableVertexArrayAttrib(batch->vao, color_loc);
+	glVertexArrayAttribBinding(batch->vao, color_loc, renderer->instance_binding);
+	glVertexArrayAttribFormat(batch->vao, color_loc, 4, GL_FLOAT, GL_FALSE, offsetof(instance_t, color));
+
+	// Load data
+	glNamedBufferStorage(batch->vbo, vertices.size() * sizeof(VertexType), vertices.data(), 0);
+	glNamedBufferStorage(batch->ibo, indices.size() * sizeof(unsigned int), indices.data(), 0);
+	batch->index_count = indices.size();
+
+	printf("%s(); vao=%u; vbo=%u[%zu]; ibo=%u[%zu]\n", __FUNCTION__, batch->vao, batch->vbo, vertices.size(), batch->ibo, indices.size());
+}
+
+static int scene_load_shape_renderer(
+	GLsizei capacity,
+	const shader_program_t* shader,
+	shape_renderer_t* renderer
+)
+{
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	GLsizeiptr size = static_cast<GLsizeiptr>(capacity) * SHAPE_COUNT * SHAPE_RENDERER_FRAMES * sizeof(instance_t);
+
+	renderer->shader = shader;
+	renderer->capacity = capacity;
+
+	// Create immutable instance buffer storage and map it once for the
+	// lifetime of the renderer
+	glCreateBuffers(1, &renderer->instance_buffer);
+	glNamedBufferStorage(renderer->instance_buffer, size, nullptr, flags);
+	renderer->instances = static_cast<instance_t*>(glMapNamedBufferRange(renderer->instance_buffer, 0, size, flags));
+	if (!renderer->instances) {
+		fprintf(stderr, "Failed to map instance buffer\n");
+		return -1;
+	}
+
+	// Load shape geometry
+	{
+		Cube cube;
+		std::vector<vertex_t> vertices;
+		std::vector<unsigned int> indices;
+		cube.tessellate(vertices, indices);
+		scene_load_shape_batch(vertices, indices, renderer, &renderer->batches[SHAPE_CUBE]);
+	}
+	{
+		Octahedron octahedron;
+		std::vector<vertex_t> vertices;
+		std::vector<unsigned int> indices;
+		octahedron.tessellate(vertices, indices);
+		scene_load_shape_batch(vertices, indices, renderer, &renderer->batches[SHAPE_OCTAHEDRON]);
+	}
+
+	printf("%s(); instance_buffer=%u[%zu]; capacity=%d\n", __FUNCTION__, renderer->instance_buffer, static_cast<std::size_t>(size), capacity);
+
+	return 0;
+}
+
+static void scene_shape_renderer_begin(shape_renderer_t* renderer)
+{
+	// Advance to the next instance buffer region and wait for the GPU to
+	// finish reading it, if it is still in use by a previous frame
+	renderer->frame = (renderer->frame + 1) % SHAPE_RENDERER_FRAMES;
+	GLsync& fence = renderer->fences[renderer->frame];
+	if (fence) {
+		GLenum status;
+		do {
+			status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1ms
+		} while (status == GL_TIMEOUT_EXPIRED);
+		glDeleteSync(fence);
+		fence = 0;
+	}
+
+	for (auto& batch : renderer->batches) {
+		batch.instance_count = 0;
+	}
+}
+
+static inline std::size_t scene_shape_renderer_region(const shape_renderer_t* renderer, shape_type_t shape)
+{
+	return (static_cast<std::size_t>(renderer->frame) * SHAPE_COUNT + shape) * renderer->capacity;
+}
+
+static bool scene_shape_renderer_add(
+	shape_renderer_t* renderer,
+	shape_type_t shape,
+	const glm::mat4& model,
+	const glm::vec4& color
+)
+{
+	shape_batch_t* batch = &renderer->batches[shape];
+	if (batch->instance_count >= renderer->capacity) {
+		// Instance buffer region is full
+		return false;
+	}
+
+	// Write directly to mapped instance buffer
+	instance_t* instance = renderer->instances + scene_shape_renderer_region(renderer, shape) + batch->instance_count;
+	instance->model = model;
+	instance->color = color;
+	++batch->instance_count;
+
+	return true;
+}
+
+static GLsizei scene_shape_renderer_draw(shape_renderer_t* renderer)
+{
+	GLsizei instance_count = 0;
+
+	glUseProgram(renderer->shader->program);
+	for (int shape = 0; shape < SHAPE_COUNT; ++shape) {
+		const shape_batch_t* batch = &renderer->batches[shape];
+		if (!batch->instance_count) {
+			continue;
+		}
+
+		// Point instance binding at the current region and draw all instances
+		// of this shape type at once
+		GLintptr offset = scene_shape_renderer_region(renderer, static_cast<shape_type_t>(shape)) * sizeof(instance_t);
+		glVertexArrayVertexBuffer(batch->vao, renderer->instance_binding, renderer->instance_buffer, offset, sizeof(instance_t));
+		glBindVertexArray(batch->vao);
+		glDrawElementsInstanced(GL_TRIANGLES, batch->index_count, GL_UNSIGNED_INT, 0, batch->instance_count);
+
+		instance_count += batch->instance_count;
+	}
+
+	// Fence current region such that it is not overwritten while in use
+	renderer->fences[renderer->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	return instance_count;
+}
+
+static void scene_unload_shape_renderer(shape_renderer_t* renderer)
+{
+	for (auto& fence : renderer->fences) {
+		if (fence) {
+			glDeleteSync(fence);
+			fence = 0;
+		}
+	}
+
+	for (auto& batch : renderer->batches) {
+		if (batch.vao) {
+			glDeleteVertexArrays(1, &batch.vao);
+			batch.vao = 0;
+		}
+
+		if (batch.vbo) {
+			glDeleteBuffers(1, &batch.vbo);
+			batch.vbo = 0;
+		}
+
+		if (batch.ibo) {
+			glDeleteBuffers(1, &batch.ibo);
+			batch.ibo = 0;
+		}
+	}
+
+	if (renderer->instance_buffer) {
+		// Persistent mapping must be released before deleting the buffer
+		if (renderer->instances) {
+			glUnmapNamedBuffer(renderer->instance_buffer);
+			renderer->instances = nullptr;
+		}
+		glDeleteBuffers(1, &renderer->instance_buffer);
+		renderer->instance_buffer = 0;
+	}
+}
+
 static GLuint scene_load_texture(const std::string& filename, GLenum internal_format)
 {
 	int width, height, channels;
@@ -711,6 +1176,12 @@ int scene_load_resources(void)
 		return r;
 	}
 
+	r = scene_load_shader_program("test/instanced.vert.glsl", "test/instanced.frag.glsl", &instanced_shader);
+	if (r) {
+		fprintf(stderr, "Failed to load instanced shader program\n");
+		return r;
+	}
+
 	// Load cube mesh
 	cube.tessellate(cube_vertices, cube_indices);
 	scene_load_mesh(cube_vertices, cube_indices, &textured_shader, &cube_mesh);
@@ -747,17 +1218,17 @@ int scene_load_resources(void)
 	});
 
 	// Load teapot mesh
-	teapot.tessellate(12, 12, teapot_vertices, teapot_indices);
+	Teapot::shared().tessellate(12, 12, teapot_vertices, teapot_indices);
 	scene_load_mesh(teapot_vertices, teapot_indices, &simple_shader, &teapot_mesh);
 	scene_load_mesh_normals(teapot_vertices, &simple_shader, &teapot_mesh.normals);
 
 	// Load teacup mesh
-	teacup.tessellate(8, 8, teacup_vertices, teacup_indices);
+	Teacup::shared().tessellate(8, 8, teacup_vertices, teacup_indices);
 	scene_load_mesh(teacup_vertices, teacup_indices, &simple_shader, &teacup_mesh);
 	scene_load_mesh_normals(teacup_vertices, &simple_shader, &teacup_mesh.normals);
 
 	// Load teaspoon mesh
-	teaspoon.tessellate(8, 8, teaspoon_vertices, teaspoon_indices);
+	Teaspoon::shared().tessellate(8, 8, teaspoon_vertices, teaspoon_indices);
 	scene_load_mesh(teaspoon_vertices, teaspoon_indices, &simple_shader, &teaspoon_mesh);
 	scene_load_mesh_normals(teaspoon_vertices, &simple_shader, &teaspoon_mesh.normals);
 
@@ -766,6 +1237,20 @@ int scene_load_resources(void)
 	scene_load_mesh(sphere_vertices, sphere_indices, &simple_shader, &sphere_mesh);
 	scene_load_mesh_normals(sphere_vertices, &simple_shader, &sphere_mesh.normals);
 
+	// Load parametric shapes
+	scene_load_parametric(32, 16, &simple_shader);
+
+	// Load instanced shape renderer
+	r = scene_load_shape_renderer(
+		INSTANCED_GRID_SIZE * INSTANCED_GRID_SIZE * INSTANCED_GRID_SIZE,
+		&instanced_shader,
+		&shape_renderer
+	);
+	if (r) {
+		fprintf(stderr, "Failed to load instanced shape renderer\n");
+		return r;
+	}
+
 	return 0;
 }
 
@@ -787,25 +1272,25 @@ static void scene_unload_shader_program(shader_program_t* shader_program)
 
 static void scene_unload_mesh(mesh_t* mesh)
 {
-	if (mesh->vao) {
-		glDeleteVertexArrays(1, &mesh->vao);
-		mesh->vao = 0;
-	}
+	// Vertex array objects are owned by the VAO cache
+	mesh->vao = 0;
 
 	if (mesh->vbo) {
 		glDeleteBuffers(1, &mesh->vbo);
 		mesh->vbo = 0;
 	}
 
+	if (mesh->position_vbo) {
+		glDeleteBuffers(1, &mesh->position_vbo);
+		mesh->position_vbo = 0;
+	}
+
 	if (mesh->ibo) {
 		glDeleteBuffers(1, &mesh->ibo);
 		mesh->ibo = 0;
 	}
 
-	if (mesh->normals.vao) {
-		glDeleteVertexArrays(1, &mesh->normals.vao);
-		mesh->normals.vao = 0;
-	}
+	mesh->normals.vao = 0;
 
 	if (mesh->normals.vbo) {
 		glDeleteBuffers(1, &mesh->normals.vbo);
@@ -827,10 +1312,15 @@ void scene_unload_resources(void)
 	scene_unload_mesh(&teacup_mesh);
 	scene_unload_mesh(&teaspoon_mesh);
 	scene_unload_mesh(&sphere_mesh);
+	scene_unload_mesh(&parametric_mesh);
+	scene_unload_topology_buffers();
+	scene_unload_shape_renderer(&shape_renderer);
+	vao_cache.clear();
 
 	scene_unload_shader_program(&simple_shader);
 	scene_unload_shader_program(&textured_shader);
 	scene_unload_shader_program(&pbr_shader);
+	scene_unload_shader_program(&instanced_shader);
 }
 
 void scene_update(void)
@@ -838,12 +1328,180 @@ void scene_update(void)
 	++tick;
 }
 
+static void scene_render_parametric(void)
+{
+	const shader_program_t* shader = parametric_mesh.shader;
+	if (!shader) {
+		return;
+	}
+
+	// Uniform matrices
+	glm::mat4 m_projection = glm::perspective(glm::radians(45.0f), width / (float)height, 0.1f, 100.0f);
+	glm::mat4 m_view = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -8.0f));
+	glm::mat4 m_model_rotate_x = glm::rotate(glm::mat4(1.0f), glm::radians((float)tick / 2.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+	glm::mat4 m_model_rotate_y = glm::rotate(glm::mat4(1.0f), glm::radians((float)tick / 2.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 m_model_rotate = m_model_rotate_y * m_model_rotate_x;
+	glProgramUniformMatrix4fv(shader->program, shader->uniform("m_view"), 1, GL_FALSE, glm::value_ptr(m_view));
+
+	// Uniform light parameters (world space)
+	glm::vec4 light_position = glm::vec4(15.0f, 15.0f, 15.0f, 1.0f);
+	glm::vec3 light_ambient = glm::vec3(0.2f, 0.2f, 0.2f);
+	glm::vec3 light_diffuse = glm::vec3(0.8f, 0.8f, 0.8f);
+	glm::vec3 light_specular = glm::vec3(1.0f, 1.0f, 1.0f);
+	glProgramUniform4fv(shader->program, shader->uniform("light.position"), 1, glm::value_ptr(light_position));
+	glProgramUniform3fv(shader->program, shader->uniform("light.ambient"), 1, glm::value_ptr(light_ambient));
+	glProgramUniform3fv(shader->program, shader->uniform("light.diffuse"), 1, glm::value_ptr(light_diffuse));
+	glProgramUniform3fv(shader->program, shader->uniform("light.specular"), 1, glm::value_ptr(light_specular));
+
+	// Uniform material parameters
+	glm::vec3 material_specular = glm::vec3(1.0f, 1.0f, 1.0f);
+	float material_shininess = 25;
+	glProgramUniform3fv(shader->program, shader->uniform("material.specular"), 1, glm::value_ptr(material_specular));
+	glProgramUniform1f(shader->program, shader->uniform("material.shininess"), material_shininess);
+
+	// Render parts
+	// The element buffer binding only changes when the topology changes
+	glUseProgram(shader->program);
+	VertexArrayCache::bind(parametric_mesh.vao, parametric_mesh.vbo_binding, parametric_mesh.vbo, parametric_mesh.vbo_stride);
+	const topology_buffer_t* current_topology = nullptr;
+	for (const auto& part : parametric_parts) {
+		glm::mat4 m_model = glm::translate(glm::mat4(1.0f), part.translation) * m_model_rotate;
+		glm::mat4 m_modelview = m_view * m_model;
+		glm::mat3 m_normal = glm::inverseTranspose(glm::mat3(m_modelview));
+		glm::mat4 m_mvp = m_projection * m_modelview;
+		glm::vec3 material_ambient = part.color * 0.25f;
+		glProgramUniformMatrix4fv(shader->program, shader->uniform("m_modelview"), 1, GL_FALSE, glm::value_ptr(m_modelview));
+		glProgramUniformMatrix3fv(shader->program, shader->uniform("m_normal"), 1, GL_FALSE, glm::value_ptr(m_normal));
+		glProgramUniformMatrix4fv(shader->program, shader->uniform("m_mvp"), 1, GL_FALSE, glm::value_ptr(m_mvp));
+		glProgramUniform3fv(shader->program, shader->uniform("material.ambient"), 1, glm::value_ptr(material_ambient));
+		glProgramUniform3fv(shader->program, shader->uniform("material.diffuse"), 1, glm::value_ptr(part.color));
+
+		const topology_buffer_t* topology = &topology_buffers.at(part.topology);
+		if (topology != current_topology) {
+			glVertexArrayElementBuffer(parametric_mesh.vao, topology->ibo);
+			current_topology = topology;
+		}
+		glDrawElementsBaseVertex(GL_TRIANGLES, topology->index_count, GL_UNSIGNED_INT, 0, part.base_vertex);
+	}
+
+	// Cleanup
+	glBindVertexArray(0);
+	glUseProgram(0);
+}
+
+static void scene_render_instanced(void)
+{
+	const shader_program_t* shader = shape_renderer.shader;
+	if (!shader || !shape_renderer.instances) {
+		return;
+	}
+
+	// Uniform matrices
+	// Individual shapes are animated using instance transforms instead
+	glm::mat4 m_projection = glm::perspective(glm::radians(45.0f), width / (float)height, 0.1f, 100.0f);
+	glm::mat4 m_view = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -8.0f));
+	glm::mat4 m_model = glm::rotate(glm::mat4(1.0f), glm::radians((float)tick / 8.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 m_modelview = m_view * m_model;
+	glm::mat3 m_normal = glm::inverseTranspose(glm::mat3(m_modelview));
+	glm::mat4 m_mvp = m_projection * m_modelview;
+
+	glProgramUniformMatrix4fv(shader->program, shader->uniform("m_modelview"), 1, GL_FALSE, glm::value_ptr(m_modelview));
+	glProgramUniformMatrix3fv(shader->program, shader->uniform("m_normal"), 1, GL_FALSE, glm::value_ptr(m_normal));
+	glProgramUniformMatrix4fv(shader->program, shader->uniform("m_view"), 1, GL_FALSE, glm::value_ptr(m_view));
+	glProgramUniformMatrix4fv(shader->program, shader->uniform("m_mvp"), 1, GL_FALSE, glm::value_ptr(m_mvp));
+
+	// Uniform light parameters (world space)
+	glm::vec4 light_position = glm::vec4(15.0f, 15.0f, 15.0f, 1.0f);
+	glm::vec3 light_ambient = glm::vec3(0.2f, 0.2f, 0.2f);
+	glm::vec3 light_diffuse = glm::vec3(0.8f, 0.8f, 0.8f);
+	glm::vec3 light_specular = glm::vec3(1.0f, 1.0f, 1.0f);
+	glProgramUniform4fv(shader->program, shader->uniform("light.position"), 1, glm::value_ptr(light_position));
+	glProgramUniform3fv(shader->program, shader->uniform("light.ambient"), 1, glm::value_ptr(light_ambient));
+	glProgramUniform3fv(shader->program, shader->uniform("light.diffuse"), 1, glm::value_ptr(light_diffuse));
+	glProgramUniform3fv(shader->program, shader->uniform("light.specular"), 1, glm::value_ptr(light_specular));
+
+	// Uniform material parameters
+	// Ambient and diffuse colours are provided per instance
+	glm::vec3 material_specular = glm::vec3(1.0f, 1.0f, 1.0f);
+	float material_shininess = 25;
+	glProgramUniform3fv(shader->program, shader->uniform("material.specular"), 1, glm::value_ptr(material_specular));
+	glProgramUniform1f(shader->program, shader->uniform("material.shininess"), material_shininess);
+
+	// Stream per-instance transforms and colours for a grid of alternating
+	// cubes and octahedra
+	const float spacing = 6.0f / INSTANCED_GRID_SIZE;
+	const float scale = spacing * 0.3f;
+	const float origin = -0.5f * spacing * (INSTANCED_GRID_SIZE - 1);
+	scene_shape_renderer_begin(&shape_renderer);
+	for (int x = 0; x < INSTANCED_GRID_SIZE; ++x) {
+		for (int y = 0; y < INSTANCED_GRID_SIZE; ++y) {
+			for (int z = 0; z < INSTANCED_GRID_SIZE; ++z) {
+				glm::vec3 position = glm::vec3(origin) + glm::vec3(x, y, z) * spacing;
+				glm::vec3 axis = glm::normalize(glm::vec3(x + 1, y + 1, z + 1));
+				float angle = glm::radians((float)tick + (x + y + z) * 10.0f);
+
+				glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
+				model = glm::rotate(model, angle, axis);
+				model = glm::scale(model, glm::vec3(scale));
+
+				glm::vec4 color = glm::vec4(glm::vec3(x, y, z) / (float)(INSTANCED_GRID_SIZE - 1), 1.0f);
+
+				scene_shape_renderer_add(
+					&shape_renderer,
+					((x + y + z) % 2) ? SHAPE_OCTAHEDRON : SHAPE_CUBE,
+					model,
+					color
+				);
+			}
+		}
+	}
+
+	// Render all instances
+	GLsizei instance_count = scene_shape_renderer_draw(&shape_renderer);
+
+	// Report instance throughput
+	if (benchmark) {
+		auto now = std::chrono::steady_clock::now();
+		if (!instanced_benchmark.frame_count) {
+			instanced_benchmark.start = now;
+		}
+		instanced_benchmark.instance_count += instance_count;
+		++instanced_benchmark.frame_count;
+
+		std::chrono::duration<double> elapsed = now - instanced_benchmark.start;
+		if (elapsed.count() >= 1.0) {
+			printf("%s(); frames=%u; instances=%llu; %.0f instances/s; %.1f frames/s\n",
+				__FUNCTION__,
+				instanced_benchmark.frame_count,
+				instanced_benchmark.instance_count,
+				instanced_benchmark.instance_count / elapsed.count(),
+				instanced_benchmark.frame_count / elapsed.count()
+			);
+			instanced_benchmark = benchmark_t();
+		}
+	}
+
+	// Cleanup
+	glBindVertexArray(0);
+	glUseProgram(0);
+}
+
 void scene_render(enum scene_demo_t scene_demo)
 {
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 	glViewport(0, 0, width, height);
 
+	if (scene_demo == SCENE_DEMO_PARAMETRIC) {
+		scene_render_parametric();
+		return;
+	}
+
+	if (scene_demo == SCENE_DEMO_INSTANCED) {
+		scene_render_instanced();
+		return;
+	}
+
 	// Determine current mesh and shader program
 	const mesh_t* current_mesh = nullptr;
 	const shader_program_t* current_shader = nullptr;
@@ -920,7 +1578,7 @@ void scene_render(enum scene_demo_t scene_demo)
 
 	// Render current mesh
 	glUseProgram(current_shader->program);
-	glBindVertexArray(current_mesh->vao);
+	scene_bind_mesh(current_mesh);
 	glDrawElements(GL_TRIANGLES, current_mesh->index_count, GL_UNSIGNED_INT, 0);
 
 	if (render_normals && current_mesh->normals.vao) {
@@ -946,8 +1604,15 @@ void scene_render(enum scene_demo_t scene_demo)
 
 		// Render current normals
 		glUseProgram(normal_shader->program);
-		glBindVertexArray(current_mesh->normals.vao);
-		glDrawArrays(GL_LINES, 0, current_mesh->normals.vertex_count);
+		scene_bind_mesh_normals(current_mesh);
+		if (current_mesh->normals.vbo) {
+			glDrawArrays(GL_LINES, 0, current_mesh->normals.vertex_count);
+		} else {
+			// One instance of two vertices per mesh vertex
+			glProgramUniform1f(normal_shader->program, normal_shader->uniform("normal_length"), 0.3f);
+			glDrawArraysInstanced(GL_LINES, 0, 2, current_mesh->vertex_count);
+			glProgramUniform1f(normal_shader->program, normal_shader->uniform("normal_length"), 0.0f);
+		}
 	}
 
 	// Cleanup
@@ -957,7 +1622,7 @@ void scene_render(enum scene_demo_t scene_demo)
 
 enum scene_demo_t scene_next_demo(enum scene_demo_t current_demo)
 {
-	if (current_demo < SCENE_DEMO_SPHERE) {
+	if (current_demo < SCENE_DEMO_INSTANCED) {
 		return static_cast<scene_demo_t>(static_cast<int>(current_demo) + 1);
 	} else {
 		return SCENE_DEMO_CUBE;
@@ -974,6 +1639,12 @@ void scene_set_wireframe(bool enabled)
 	glPolygonMode(GL_FRONT_AND_BACK, enabled ? GL_LINE : GL_FILL);
 }
 
+void scene_set_benchmark(bool enabled)
+{
+	benchmark = enabled;
+	instanced_benchmark = benchmark_t();
+}
+
 void scene_set_complexity(int subdivision_delta)
 {
 	std::size_t sub_count;
@@ -998,25 +1669,25 @@ void scene_set_complexity(int subdivision_delta)
 
 	// Update teapot mesh
 	sub_count = glm::clamp(12 + subdivision_delta, 2, 24);
-	teapot.tessellate(sub_count, sub_count, teapot_vertices, teapot_indices);
+	Teapot::shared().tessellate(sub_count, sub_count, teapot_vertices, teapot_indices);
 	scene_update_mesh(teapot_vertices, teapot_indices, &teapot_mesh);
-	scene_update_mesh_normals(teapot_vertices, &teapot_mesh.normals);
 
 	// Update teacup mesh
 	sub_count = glm::clamp(8 + subdivision_delta, 2, 16);
-	teacup.tessellate(sub_count, sub_count, teacup_vertices, teacup_indices);
+	Teacup::shared().tessellate(sub_count, sub_count, teacup_vertices, teacup_indices);
 	scene_update_mesh(teacup_vertices, teacup_indices, &teacup_mesh);
-	scene_update_mesh_normals(teacup_vertices, &teacup_mesh.normals);
 
 	// Update teaspoon mesh
 	sub_count = glm::clamp(8 + subdivision_delta, 2, 16);
-	teaspoon.tessellate(sub_count, sub_count, teaspoon_vertices, teaspoon_indices);
+	Teaspoon::shared().tessellate(sub_count, sub_count, teaspoon_vertices, teaspoon_indices);
 	scene_update_mesh(teaspoon_vertices, teaspoon_indices, &teaspoon_mesh);
-	scene_update_mesh_normals(teaspoon_vertices, &teaspoon_mesh.normals);
 
 	// Update sphere mesh
 	sub_count = glm::clamp(3 + subdivision_delta, 0, 4);
 	sphere.tessellate(sub_count, sphere_vertices, sphere_indices);
 	scene_update_mesh(sphere_vertices, sphere_indices, &sphere_mesh);
-	scene_update_mesh_normals(sphere_vertices, &sphere_mesh.normals);
+
+	// Update parametric shapes
+	sub_count = glm::clamp(16 + subdivision_delta, 3, 32);
+	scene_tessellate_parametric(sub_count * 2, sub_count);
 }
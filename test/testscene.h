@@ -23,6 +23,8 @@ enum scene_demo_t {
 	SCENE_DEMO_TEACUP,
 	SCENE_DEMO_TEASPOON,
 	SCENE_DEMO_SPHERE,
+	SCENE_DEMO_PARAMETRIC,
+	SCENE_DEMO_INSTANCED,
 };
 
 int scene_init(void);
@@ -45,6 +47,8 @@ void scene_set_wireframe(bool enabled);
 
 void scene_set_complexity(int subdivision_delta);
 
+void scene_set_benchmark(bool enabled);
+
 __END_DECLS
 
 #endif
@@ -14,6 +14,13 @@ uniform mat3 m_normal;
 uniform mat4 m_view;
 uniform mat4 m_mvp;
 
+// Dequantization of normalized integer positions; identity for float positions
+uniform vec3 position_scale = vec3(1.0);
+uniform vec3 position_bias = vec3(0.0);
+
+// Packed normals are octahedral encoded in v_normal.xy
+uniform bool octahedral_normal = false;
+
 struct light_t {
 	vec4 position;
 	vec3 ambient;
@@ -36,15 +43,27 @@ out vec3 f_l;
 out vec3 f_v;
 out vec2 f_texcoord;
 
+vec3 oct_decode(vec2 e)
+{
+	// Unfold lower hemisphere of octahedral mapping
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+	return normalize(n);
+}
+
 void main()
 {
+	vec3 v_position_dq = position_bias + position_scale * v_position;
+	vec3 normal = octahedral_normal ? oct_decode(v_normal.xy) : v_normal;
+
 	// Compute eye space vectors
-	vec4 position = m_modelview * vec4(v_position, 1.0);
-	f_n = m_normal * v_normal; // Normal vector
+	vec4 position = m_modelview * vec4(v_position_dq, 1.0);
+	f_n = m_normal * normal; // Normal vector
 	f_l = vec3(m_view * light.position - position); // Light vector
 	f_v = vec3(-position); // Viewer vector
 
 	f_texcoord = v_texcoord;
 
-	gl_Position = m_mvp * vec4(v_position, 1.0);
+	gl_Position = m_mvp * vec4(v_position_dq, 1.0);
 }
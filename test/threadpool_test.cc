@@ -0,0 +1,66 @@
+/**
+ * @file threadpool_test.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "threadpool.h"
+
+#include <atomic>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+static bool run_loop(ThreadPool& pool)
+{
+	std::vector<std::size_t> slots(10000, 0);
+	pool.parallelFor(slots.size(), [&slots](std::size_t i) { slots[i] = i * 2; });
+	for (std::size_t i = 0; i < slots.size(); ++i) {
+		if (slots[i] != i * 2) {
+			return false;
+		}
+	}
+	return true;
+}
+
+int main()
+{
+	ThreadPool pool(4);
+
+	if (!run_loop(pool)) {
+		std::fprintf(stderr, "Parallel loop results differ\n");
+		return 1;
+	}
+
+	// Exceptions from any thread reach the caller after all threads have
+	// stopped using the loop body and its captured locals
+	for (std::size_t failing : { std::size_t(0), std::size_t(5000), std::size_t(9999) }) {
+		bool caught = false;
+		try {
+			std::vector<int> locals(10000, 1);
+			pool.parallelFor(locals.size(), [&](std::size_t i) {
+				if (i == failing) {
+					throw std::runtime_error("failure");
+				}
+				locals[i] = 2;
+			});
+		} catch (const std::runtime_error&) {
+			caught = true;
+		}
+		if (!caught) {
+			std::fprintf(stderr, "Exception at index %zu not rethrown\n", failing);
+			return 1;
+		}
+	}
+
+	// The pool remains usable after an exception
+	if (!run_loop(pool)) {
+		std::fprintf(stderr, "Parallel loop failed after exception\n");
+		return 1;
+	}
+
+	return 0;
+}
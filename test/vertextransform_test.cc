@@ -0,0 +1,153 @@
+/**
+ * @file vertextransform_test.cc
+ *
+ * Copyright (c) 2026 Leon Lynch
+ *
+ * This file is licensed under the terms of the MIT license.
+ * See LICENSE file.
+ */
+
+#include "vertextransform.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Rotation about z by 30 degrees, non-uniform scale and translation
+static const float matrix[16] = {
+	0.8660254f * 2.0f, -0.5f * 0.5f, 0.0f, 1.0f,
+	0.5f * 2.0f, 0.8660254f * 0.5f, 0.0f, -2.0f,
+	0.0f, 0.0f, 3.0f, 0.5f,
+	0.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float identity[16] = {
+	1.0f, 0.0f, 0.0f, 0.0f,
+	0.0f, 1.0f, 0.0f, 0.0f,
+	0.0f, 0.0f, 1.0f, 0.0f,
+	0.0f, 0.0f, 0.0f, 1.0f,
+};
+
+// Number of vectors including a tail that is not a multiple of four
+static const std::size_t count = 1027;
+
+// Output stride with room for other interleaved attributes
+static const std::size_t stride = 11;
+
+static bool near(float a, float b)
+{
+	return std::fabs(a - b) <= 1e-4f * std::fmax(1.0f, std::fabs(b));
+}
+
+int main()
+{
+	std::vector<float> src(count * 3);
+	std::vector<float> dst(count * stride, -1.0f);
+	float tangent_matrix[9];
+	float normal_matrix[9];
+
+	std::srand(1);
+	for (auto&& v : src) {
+		v = std::rand() / static_cast<float>(RAND_MAX) * 2.0f - 1.0f;
+	}
+	// Zero length vector must remain zero when normalized
+	src[3] = src[4] = src[5] = 0.0f;
+
+	for (std::size_t i = 0; i < 9; ++i) {
+		tangent_matrix[i] = matrix[(i / 3) * 4 + (i % 3)];
+	}
+	normalMatrix(matrix, normal_matrix);
+
+	if (!matrixIsIdentity(identity) ||
+		matrixIsIdentity(matrix)
+	) {
+		std::fprintf(stderr, "matrixIsIdentity() failed\n");
+		return 1;
+	}
+
+	// Points
+	transformPoints(matrix, src.data(), count, dst.data(), stride);
+	for (std::size_t i = 0; i < count; ++i) {
+		const float* p = &src[i * 3];
+		const float* r = &dst[i * stride];
+		for (std::size_t row = 0; row < 3; ++row) {
+			const float* m = &matrix[row * 4];
+			float expected = m[0] * p[0] + m[1] * p[1] + m[2] * p[2] + m[3];
+			if (!near(r[row], expected)) {
+				std::fprintf(stderr, "transformPoints() failed at %zu\n", i);
+				return 1;
+			}
+		}
+		if (r[3] != -1.0f) {
+			std::fprintf(stderr, "transformPoints() wrote beyond vector %zu\n", i);
+			return 1;
+		}
+	}
+
+	// Bounds accumulated while writing points must match a scan of the
+	// output, including the scalar tail
+	float bounds_min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+	float bounds_max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	float scan_min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+	float scan_max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	transformPoints(matrix, src.data(), count, dst.data(), stride, bounds_min, bounds_max);
+	pointBounds(dst.data(), count, stride, scan_min, scan_max);
+	for (std::size_t c = 0; c < 3; ++c) {
+		float lo = FLT_MAX;
+		float hi = -FLT_MAX;
+		for (std::size_t i = 0; i < count; ++i) {
+			lo = std::fmin(lo, dst[i * stride + c]);
+			hi = std::fmax(hi, dst[i * stride + c]);
+		}
+		if (bounds_min[c] != lo || bounds_max[c] != hi ||
+			scan_min[c] != lo || scan_max[c] != hi
+		) {
+			std::fprintf(stderr, "Point bounds failed for component %zu\n", c);
+			return 1;
+		}
+	}
+
+	// Copied points are exact and extend existing bounds
+	std::vector<float> copy(count * stride, -1.0f);
+	copyPoints(src.data(), count, copy.data(), stride, bounds_min, bounds_max);
+	for (std::size_t i = 0; i < count; ++i) {
+		const float* p = &src[i * 3];
+		const float* r = &copy[i * stride];
+		if (r[0] != p[0] || r[1] != p[1] || r[2] != p[2] || r[3] != -1.0f) {
+			std::fprintf(stderr, "copyPoints() failed at %zu\n", i);
+			return 1;
+		}
+		for (std::size_t c = 0; c < 3; ++c) {
+			if (p[c] < bounds_min[c] || p[c] > bounds_max[c] ||
+				dst[i * stride + c] < bounds_min[c] || dst[i * stride + c] > bounds_max[c]
+			) {
+				std::fprintf(stderr, "copyPoints() bounds failed at %zu\n", i);
+				return 1;
+			}
+		}
+	}
+
+	// Normals must remain perpendicular to transformed tangents
+	std::vector<float> tangents(count * stride);
+	transformVectors(tangent_matrix, true, src.data(), count, tangents.data(), stride);
+	for (std::size_t i = 0; i < count; ++i) {
+		// Arbitrary normal perpendicular to source vector i
+		const float* t = &src[i * 3];
+		float n[3] = { t[1], -t[0], 0.0f };
+		float tn[3];
+		transformVectors(normal_matrix, true, n, 1, tn, 3);
+
+		const float* tt = &tangents[i * stride];
+		float dot = tt[0] * tn[0] + tt[1] * tn[1] + tt[2] * tn[2];
+		float length = std::sqrt(tt[0] * tt[0] + tt[1] * tt[1] + tt[2] * tt[2]);
+		bool zero = t[0] == 0.0f && t[1] == 0.0f && t[2] == 0.0f;
+		if (std::fabs(dot) > 1e-5f || (zero ? length != 0.0f : !near(length, 1.0f))) {
+			std::fprintf(stderr, "transformVectors() failed at %zu\n", i);
+			return 1;
+		}
+	}
+
+	return 0;
+}